@@ -3,6 +3,7 @@ CONFIG += console
 CONFIG -= app_bundle
 CONFIG -= qt
 CONFIG += c++11
+CONFIG += thread
 
 DESTDIR = $$_PRO_FILE_PWD_/build
 
@@ -15,9 +16,25 @@ SOURCES +=  example/main.cpp \
             src/population.cpp \
             src/singleobjectivega.cpp \
             src/nsgaii.cpp \
+            src/nondominatedsorting.cpp \
+            src/threadpool.cpp \
+            src/random.cpp \
+            src/bitstringchromosome.cpp \
+            src/fixedchromosome.cpp \
+            src/soapopulation.cpp \
+            src/arena.cpp \
+            src/fitnesscache.cpp \
+            src/binarydecoder.cpp \
+            src/realchromosome.cpp \
+            src/runlog.cpp \
+            src/asyncrunlogwriter.cpp \
+            src/runhistory.cpp \
+            src/checkpoint.cpp \
             example/roulettewheel.cpp \
             example/chromosomeintint.cpp \
             example/chromosomemdoubleint.cpp \
+            example/chromosomeonemax.cpp \
+            example/chromosomesch1.cpp \
             example/tournamentm.cpp \
             src/General.cpp
 
@@ -28,8 +45,24 @@ HEADERS +=  include/ga.h \
             include/singleobjectivega.h \
             include/AlgoString.h \
             include/nsgaii.h \
+            include/nondominatedsorting.h \
+            include/threadpool.h \
+            include/random.h \
+            include/bitstringchromosome.h \
+            include/fixedchromosome.h \
+            include/soapopulation.h \
+            include/arena.h \
+            include/fitnesscache.h \
+            include/binarydecoder.h \
+            include/realchromosome.h \
+            include/runlog.h \
+            include/asyncrunlogwriter.h \
+            include/runhistory.h \
+            include/checkpoint.h \
             example/roulettewheel.h \
             example/chromosomeintint.h \
             example/chromosomemdoubleint.h \
+            example/chromosomeonemax.h \
+            example/chromosomesch1.h \
             example/tournamentm.h
 
@@ -4,18 +4,10 @@ ChromosomeMDoubleInt::ChromosomeMDoubleInt()
     : Chromosome<double, int>()
     , m_crowdingDistance(0)
     , m_rank(-1)
-    , m_nbSolutionDominatesMe(0)
-    , m_dominatedSolutions()
 {
 }
 
-void ChromosomeMDoubleInt::resetDominance()
-{
-    m_nbSolutionDominatesMe = 0;
-    m_dominatedSolutions.clear();
-}
-
-bool ChromosomeMDoubleInt::dominates(const ChromosomeMDoubleInt& other)
+bool ChromosomeMDoubleInt::dominates(const ChromosomeMDoubleInt& other) const
 {
     const unsigned int nbMaxObjective = std::min(m_fitness.size(), other.m_fitness.size());
 
@@ -90,8 +82,3 @@ void ChromosomeMDoubleInt::generateRandomChromosome()
     for (unsigned int i = 0 ; i < m_nbGenes ; ++i)
         m_datas.push_back(distribution(generator));
 }
-
-void ChromosomeMDoubleInt::addDominatedSolution(ChromosomeMDoubleInt* other)
-{
-    m_dominatedSolutions.push_back(other);
-}
@@ -11,22 +11,16 @@ class ChromosomeMDoubleInt
 protected:
     double m_crowdingDistance;                          ///> Crowding distance (to measure how solutions are crowed).
     int m_rank;                                         ///> Rank of the solution (or front).
-    int m_nbSolutionDominatesMe;                        ///> Number of solutions that dominates this solution.
-    std::vector<ChromosomeMDoubleInt*> m_dominatedSolutions;///> Solution dominated by this one.
 
 public:
     ChromosomeMDoubleInt();
 
-    /**
-     * @brief resetDominance Reset Values of m_dominatedSolutions and m_nbSolutionDominatesMe.
-     */
-    virtual void resetDominance();
     /**
      * @brief dominates Check which solution dominates the other.
      * @param other Solution that will be checked.
      * @return true if current solution dominates other, otherwise false.
      */
-    virtual bool dominates(const ChromosomeMDoubleInt& other);
+    virtual bool dominates(const ChromosomeMDoubleInt& other) const;
 
     virtual bool mutate();
     virtual void computeFitness();
@@ -53,30 +47,6 @@ public:
      * @param rank Rank wanted.
      */
     inline void setRank(const int rank) { m_rank = rank; }
-
-    /**
-     * @brief getDominatedSolution Solutions dominated by this chromosome.
-     * @return Vector of solutions dominated by this chromosome.
-     */
-    inline std::vector<ChromosomeMDoubleInt*> getDominatedSolution() { return m_dominatedSolutions; }
-
-    /**
-     * @brief addDominatedSolution Add a chromosome to the vector of solutions dominated.
-     * @param other chromosome to add.
-     */
-    virtual void addDominatedSolution(ChromosomeMDoubleInt *other);
-
-    /**
-     * @brief setNbSolutionDominatesMe Set the number of solutions that dominates this one.
-     * @param nb Number of solutions that dominates this one.
-     */
-    inline void setNbSolutionDominatesMe(const int nb) { m_nbSolutionDominatesMe = nb; }
-
-    /**
-     * @brief getNbSolutionDominatesMe Get the number of solutions that dominates this one.
-     * @return Number of solutions that dominates this one.
-     */
-    inline int getNbSolutionDominatesMe() { return m_nbSolutionDominatesMe; }
 };
 
 #endif // ChromosomeMDoubleInt_H
@@ -0,0 +1,15 @@
+#include "chromosomeonemax.h"
+
+ChromosomeOneMax::ChromosomeOneMax()
+    : BitStringChromosome<int>()
+{
+}
+
+void ChromosomeOneMax::computeFitness()
+{
+    // Compute the fitness, in this case, it count the number of bit that value is 1
+    if (m_fitness.size() != 0)
+       m_fitness[0] = countOnes();
+    else
+        m_fitness.push_back(countOnes());
+}
@@ -0,0 +1,21 @@
+#ifndef CHROMOSOMEONEMAX_H
+#define CHROMOSOMEONEMAX_H
+
+#include "bitstringchromosome.h"
+
+/**
+ * @brief The ChromosomeOneMax class Example of packed binary chromosome, its fitness is the number of bits set to 1.
+ */
+class ChromosomeOneMax
+        : public smoga::BitStringChromosome<int>
+{
+public:
+    ChromosomeOneMax();
+
+    virtual void computeFitness();
+
+    // Operator
+    bool operator <(const ChromosomeOneMax& chromosome) const { return smoga::Chromosome<int, uint64_t>::operator <(chromosome);}
+};
+
+#endif // CHROMOSOMEONEMAX_H
@@ -0,0 +1,44 @@
+#include "chromosomesch1.h"
+
+ChromosomeSCH1::ChromosomeSCH1()
+    : RealChromosome<double>()
+    , m_crowdingDistance(0)
+    , m_rank(-1)
+{
+}
+
+bool ChromosomeSCH1::dominates(const ChromosomeSCH1& other) const
+{
+    const unsigned int nbMaxObjective = std::min(m_fitness.size(), other.m_fitness.size());
+
+    // 2 conditions :
+    // The current solution is no worse than other solution in all objectives
+    for (unsigned int o = 0 ; o < nbMaxObjective ; ++o)
+    {
+        if (m_fitness[o] > other.m_fitness[o])
+            return false;
+    }
+
+    // The current solution is strictly better than other solution in at least one objective
+    for (unsigned int o = 0 ; o < nbMaxObjective ; ++o)
+    {
+        if (m_fitness[o] < other.m_fitness[o])
+            return true;
+    }
+
+    return false;
+}
+
+void ChromosomeSCH1::computeFitness()
+{
+    // Problem SCH1 :
+    // Minimize f1 =   x²
+    // Minimize f2 = (x-2)²
+    // x is the gene itself, set bounds with RealChromosome::setBounds (ex : [-1000, 1000])
+
+    const double value = m_datas[0];
+
+    m_fitness.resize(2);
+    m_fitness[0] = value*value;
+    m_fitness[1] = (value-2)*(value-2);
+}
@@ -0,0 +1,51 @@
+#ifndef CHROMOSOMESCH1_H
+#define CHROMOSOMESCH1_H
+
+#include "realchromosome.h"
+
+/**
+ * @brief The ChromosomeSCH1 class Example of real-coded chromosome, solving the problem SCH1 without decoding its gene.
+ */
+class ChromosomeSCH1
+        : public smoga::RealChromosome<double>
+{
+protected:
+    double m_crowdingDistance;                          ///> Crowding distance (to measure how solutions are crowed).
+    int m_rank;                                         ///> Rank of the solution (or front).
+
+public:
+    ChromosomeSCH1();
+
+    /**
+     * @brief dominates Check which solution dominates the other.
+     * @param other Solution that will be checked.
+     * @return true if current solution dominates other, otherwise false.
+     */
+    virtual bool dominates(const ChromosomeSCH1& other) const;
+
+    virtual void computeFitness();
+
+    /**
+     * @brief getDistance Get crowding distance of the chromosome.
+     * @return Crowding distance.
+     */
+    inline double getDistance() const { return m_crowdingDistance; }
+    /**
+     * @brief setDistance Set crowding distance of the chromosome.
+     * @param dist Crowding distance.
+     */
+    inline void setDistance(const double dist) { m_crowdingDistance = dist; }
+
+    /**
+     * @brief getRank Get the Rank of the chromosome.
+     * @return Rank.
+     */
+    inline int getRank() const { return m_rank; }
+    /**
+     * @brief setRank Set the Rank of the chromosome.
+     * @param rank Rank wanted.
+     */
+    inline void setRank(const int rank) { m_rank = rank; }
+};
+
+#endif // CHROMOSOMESCH1_H
@@ -28,6 +28,7 @@ int main()
         // Example of changing parameters to have a specific configuration of the GA used.
         //sGa.setElistism(false);
         //sGa.setNbGenerationsWanted(500);
+        //sGa.setNbThreads(0); // Compute fitness with all cores ("Number Threads" in params file)
         //ChromosomeIntInt::setNbGenes(100);
         //RouletteWheel<int, int, ChromosomeIntInt>::setSNbMaxChromosomes(50);
         //RouletteWheel<int, int, ChromosomeIntInt>::setProportionalKeeping(0.3);
@@ -44,6 +45,9 @@ int main()
 
         // Example of changing parameters to have a specific configuration of the GA used.
         // Same method, described above, except there isn't function setElitism and setProportionalKeeping.
+        // The engine used to determine non-dominated fronts can also be changed (fast non-dominated sort of Deb by default).
+        //nsga2.setNonDominatedSorter(new smoga::JensenFortinSorter<double, TournamentM<double, int, ChromosomeMDoubleInt>, ChromosomeMDoubleInt>());
+        //nsga2.setNbThreads(0);
 
         nsga2.initialize();
         std::vector<ChromosomeMDoubleInt> results = nsga2.performGA();
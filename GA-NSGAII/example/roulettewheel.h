@@ -2,6 +2,8 @@
 #define ROULETTEWHEEL_H
 
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #include "population.h"
 #include "chromosomeintint.h"
@@ -9,13 +11,40 @@
 template<typename F, typename DATA, typename C>
 /**
  * @brief The RouletteWheel class Provide a selection of parents to breeding based on a roulette wheel.
+ * A chromosome is drawn with a probability proportional to its fitness, in O(1) with an alias table,
+ * or all parents of a breeding are drawn at once in O(N) with a stochastic universal sampling.
  */
 class RouletteWheel
         : public smoga::Population<F, DATA, C>
 {
+public:
+    /**
+     * @brief The SelectionMethod enum Method used to spin the roulette wheel.
+     */
+    enum SelectionMethod
+    {
+        ALIAS_METHOD,                   ///> Each parent is drawn independently with Walker's alias table
+        STOCHASTIC_UNIVERSAL_SAMPLING   ///> Parents of a breeding are drawn with equally spaced pointers
+    };
+
 protected:
+    static SelectionMethod m_selectionMethod;   ///> Method used to spin the roulette wheel.
+
     std::vector< F > m_cumulatedFitness;        ///> Store the cumulated fitness
     std::vector< double > m_selectingProba;     ///> Store all probability to be selected by the roulette wheel
+    std::vector< double > m_aliasProba;         ///> Probability to keep the chromosome of a column of the alias table
+    std::vector< unsigned int > m_alias;        ///> Chromosome taken instead of the one of a column of the alias table
+    std::vector< unsigned int > m_matingPool;   ///> Chromosomes drawn for each selection of a breeding (stochastic universal sampling)
+
+    /**
+     * @brief buildAliasTable Build the alias table (Vose's algorithm) from the fitness of the chromosomes.
+     * @param totalFitness Sum of the fitness of all chromosomes, not positive to select them uniformly.
+     */
+    void buildAliasTable(const double totalFitness);
+    /**
+     * @brief buildSelectionTables Compute the cumulated fitness, the probabilities to be selected and the alias table of the sorted chromosomes.
+     */
+    void buildSelectionTables();
 
     virtual void destroy();
     virtual void copy(const RouletteWheel<F, DATA, C> &other);
@@ -25,16 +54,22 @@ public:
     RouletteWheel(const RouletteWheel& other);
 
     virtual void evaluateFitness();
+    virtual void prepareSelection();
+    virtual void restoreSelection();
     virtual C selectOneChromosome();
+    virtual unsigned int selectOneIndex();
+    virtual void prepareMatingPool(const unsigned int nbSelections);
+    virtual unsigned int selectIndex(const unsigned int selection);
     virtual std::pair< C, C > selectChromosomesPair();
-    virtual C crossOver(const std::pair< C, C > parents);
+    virtual C crossOver(const std::pair< C, C >& parents);
+    virtual void crossOver(const C& mum, const C& dad, C& offspring);
     virtual std::vector< C > getBestSolution() const;
 
     /**
      * @brief addKeptChromosomes Add Chromosomes that must be kept between two generations.
-     * @param chromosomes Vector of chromosomes that will be insert in m_chromosomes.
+     * @param chromosomes Vector of chromosomes that will be moved in m_chromosomes.
      */
-    void addKeptChromosomes(std::vector< C > chromosomes);
+    void addKeptChromosomes(std::vector< C >&& chromosomes);
 
     /**
      * @brief getKeptChromosomes Compute the vector of chromosomes that must be kept between each generation.
@@ -42,17 +77,46 @@ public:
      */
     std::vector< C > getKeptChromosomes();
 
+    /**
+     * @brief setSelectionMethod Set the method used to spin the roulette wheel.
+     * @param selectionMethod Method to use.
+     */
+    static void setSelectionMethod(const SelectionMethod selectionMethod) { m_selectionMethod = selectionMethod; }
+    /**
+     * @brief getSelectionMethod Get the method used to spin the roulette wheel.
+     * @return Method used.
+     */
+    static SelectionMethod getSelectionMethod() { return m_selectionMethod; }
+
+    /**
+     * @brief writeCheckpointParameters Write the method used to spin the roulette wheel.
+     * @param checkpoint Checkpoint receiving the parameters.
+     */
+    static void writeCheckpointParameters(smoga::CheckpointWriter& checkpoint) { checkpoint.writeValue< int32_t >(m_selectionMethod); }
+    /**
+     * @brief readCheckpointParameters Restore the method written by writeCheckpointParameters.
+     * @param checkpoint Checkpoint to read.
+     */
+    static void readCheckpointParameters(smoga::CheckpointReader& checkpoint) { setSelectionMethod(static_cast< SelectionMethod >(checkpoint.readValue< int32_t >())); }
+
     // Operator Like
     RouletteWheel& add(const RouletteWheel& op);
     // Operator
     RouletteWheel& operator=(const RouletteWheel& other);
 };
 
+// Init static variables
+template<typename F, typename DATA, typename C>
+typename RouletteWheel<F, DATA, C>::SelectionMethod RouletteWheel<F, DATA, C>::m_selectionMethod = RouletteWheel<F, DATA, C>::ALIAS_METHOD;
+
 template<typename F, typename DATA, typename C>
 RouletteWheel<F, DATA, C>::RouletteWheel(const int maxChromosome)
     : smoga::Population<F, DATA, C>(maxChromosome == -1 ? this->m_sNbMaxChromosomes : maxChromosome)
     , m_cumulatedFitness()
     , m_selectingProba()
+    , m_aliasProba()
+    , m_alias()
+    , m_matingPool()
 {
 }
 
@@ -69,6 +133,9 @@ void RouletteWheel<F, DATA, C>::destroy()
     smoga::Population<F, DATA, C>::destroy();
     m_cumulatedFitness.clear();
     m_selectingProba.clear();
+    m_aliasProba.clear();
+    m_alias.clear();
+    m_matingPool.clear();
 }
 
 template<typename F, typename DATA, typename C>
@@ -77,20 +144,39 @@ void RouletteWheel<F, DATA, C>::copy(const RouletteWheel<F, DATA, C>& other)
     smoga::Population<F, DATA, C>::copy(other);
     m_cumulatedFitness = other.m_cumulatedFitness;
     m_selectingProba = other.m_selectingProba;
+    m_aliasProba = other.m_aliasProba;
+    m_alias = other.m_alias;
+    m_matingPool = other.m_matingPool;
 }
 
 template<typename F, typename DATA, typename C>
 void RouletteWheel<F, DATA, C>::evaluateFitness()
 {
-    const unsigned int nbChromosomes = this->m_chromosomes.size();
-    for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
-        this->m_chromosomes[i].computeFitness();
+    this->computeFitnessOfChromosomes();
+    prepareSelection();
+}
 
+template<typename F, typename DATA, typename C>
+void RouletteWheel<F, DATA, C>::prepareSelection()
+{
     // Sort chromosomes to have m_chromosomes[0] with the lower fitness
     // and m_chromosomes[m_chromosomes.size()] with the hightest
     std::sort(this->m_chromosomes.begin(), this->m_chromosomes.end(), Less< C >());
 
+    buildSelectionTables();
+}
+
+template<typename F, typename DATA, typename C>
+void RouletteWheel<F, DATA, C>::restoreSelection()
+{
+    // Chromosomes are already sorted, sorting them again could swap chromosomes of equal fitness
+    buildSelectionTables();
+}
 
+template<typename F, typename DATA, typename C>
+void RouletteWheel<F, DATA, C>::buildSelectionTables()
+{
+    const unsigned int nbChromosomes = this->m_chromosomes.size();
     if (this->m_chromosomes.empty())
         return;
 
@@ -100,95 +186,149 @@ void RouletteWheel<F, DATA, C>::evaluateFitness()
     for (unsigned int i = 1 ; i < nbChromosomes ; ++i)
         this->m_cumulatedFitness.push_back(this->m_cumulatedFitness[i-1] + this->m_chromosomes[i].getFitness()[0]);
 
-    // Compute probability to be selected by the roulette wheel
+    // Compute probability to be selected by the roulette wheel, uniform if no chromosome has a positive fitness
     this->m_selectingProba.clear();
-    F maxFitness = this->m_cumulatedFitness[this->m_chromosomes.size()-1];
+    const double maxFitness = this->m_cumulatedFitness[nbChromosomes-1];
     for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
-         this->m_selectingProba.push_back(this->m_cumulatedFitness[i] / (double)maxFitness);
+         this->m_selectingProba.push_back(maxFitness > 0 ? this->m_cumulatedFitness[i] / maxFitness : (i+1) / (double)nbChromosomes);
+
+    if (m_selectionMethod == ALIAS_METHOD)
+        buildAliasTable(maxFitness);
 }
 
 template<typename F, typename DATA, typename C>
-C RouletteWheel<F, DATA, C>::selectOneChromosome()
+void RouletteWheel<F, DATA, C>::buildAliasTable(const double totalFitness)
 {
-    // Select a chromosome
-    std::uniform_real_distribution<float> distribution(0.0, 1.0);
-    float prob = distribution(generator);
-
-    unsigned int index;
-
-    // Find index of the chromosome
     const unsigned int nbChromosomes = this->m_chromosomes.size();
+    m_aliasProba.resize(nbChromosomes);
+    m_alias.resize(nbChromosomes);
+
+    // Probabilities scaled by the number of columns, columns under 1 are completed by a column over 1
+    std::vector< unsigned int > small, large;
     for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
     {
-        if (prob > this->m_selectingProba[i])
-            continue;
+        m_aliasProba[i] = totalFitness > 0 ? this->m_chromosomes[i].getFitness()[0] * nbChromosomes / totalFitness : 1;
+        m_alias[i] = i;
+        if (m_aliasProba[i] < 1)
+            small.push_back(i);
         else
+            large.push_back(i);
+    }
+
+    while (!small.empty() && !large.empty())
+    {
+        const unsigned int less = small.back();
+        const unsigned int more = large.back();
+        small.pop_back();
+
+        m_alias[less] = more;
+        m_aliasProba[more] = (m_aliasProba[more] + m_aliasProba[less]) - 1;
+        if (m_aliasProba[more] < 1)
         {
-            index = i;
-            break;
+            large.pop_back();
+            small.push_back(more);
         }
     }
 
-    return this->m_chromosomes[index];
+    // Remaining columns are full, up to rounding errors
+    for (unsigned int i = 0 ; i < small.size() ; ++i)
+        m_aliasProba[small[i]] = 1;
+    for (unsigned int i = 0 ; i < large.size() ; ++i)
+        m_aliasProba[large[i]] = 1;
 }
 
 template<typename F, typename DATA, typename C>
-std::pair<C, C> RouletteWheel<F, DATA, C>::selectChromosomesPair()
+C RouletteWheel<F, DATA, C>::selectOneChromosome()
 {
-    // Select 2 chromosomes based on their probability beteween [0, 1] to be selected
-    // It's the principle of roulette wheel, because chromosome with a better fitness
-    // Have larger interval of probability to be selected
-
-    // Select a chromosome mum and a chromosome dad
-    return std::pair< C, C >(selectOneChromosome(), selectOneChromosome());
+    return this->m_chromosomes[selectOneIndex()];
 }
 
 template<typename F, typename DATA, typename C>
-C RouletteWheel<F, DATA, C>::crossOver(const std::pair<C, C> parents)
+unsigned int RouletteWheel<F, DATA, C>::selectOneIndex()
 {
-    // Children Chromosome
-    C offspring;
-
-    std::vector<int> offspringGenes;    // Children chromosome => will be fill
-    // Get parents genes
-    std::vector<int> mumGenes = parents.first.getDatas();
-    std::vector<int> dadGenes = parents.second.getDatas();
+    const unsigned int nbChromosomes = this->m_chromosomes.size();
+    if (nbChromosomes == 0)
+        throw std::runtime_error("Impossible to select a chromosome in an empty population!");
 
-    // According to crossover probability it's the dad or mum that will begin to fill offspring genes
-    std::uniform_real_distribution<float> distribution(0.0, 1.0);
-    float probaCrossOver = distribution(generator);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    if (m_selectionMethod == ALIAS_METHOD && m_aliasProba.size() == nbChromosomes)
+    {
+        // Draw a column, then its chromosome or its alias
+        std::uniform_int_distribution<unsigned int> distributionColumn(0, nbChromosomes-1);
+        const unsigned int column = distributionColumn(generator);
+        return distribution(generator) < m_aliasProba[column] ? column : m_alias[column];
+    }
 
-    const unsigned int nbGenes = C::getNbGenes();
-    if (nbGenes == 0)
-        return offspring;
+    // Find the first chromosome whose cumulated probability reaches prob, the last one if rounding errors miss it
+    const double prob = distribution(generator);
+    const unsigned int index = std::lower_bound(this->m_selectingProba.begin(), this->m_selectingProba.end(), prob) - this->m_selectingProba.begin();
+    return std::min(index, nbChromosomes-1);
+}
 
-    // Random number to define on which genes crossover begin
-    std::uniform_int_distribution<> distributionInt(0, C::getNbGenes()-1);
-    const unsigned int indexCrossover = distributionInt(generator);
+template<typename F, typename DATA, typename C>
+void RouletteWheel<F, DATA, C>::prepareMatingPool(const unsigned int nbSelections)
+{
+    m_matingPool.clear();
+    const unsigned int nbChromosomes = this->m_chromosomes.size();
+    if (m_selectionMethod != STOCHASTIC_UNIVERSAL_SAMPLING || nbSelections == 0 || nbChromosomes == 0)
+        return;
 
-    if (probaCrossOver <= 0.5)  // Crossover with mum genes before
+    // nbSelections pointers equally spaced on the wheel, the first one being random
+    std::uniform_real_distribution<double> distribution(0.0, 1.0 / nbSelections);
+    const double firstPointer = distribution(generator);
+    m_matingPool.resize(nbSelections);
+    unsigned int index = 0;
+    for (unsigned int s = 0 ; s < nbSelections ; ++s)
     {
-        for (unsigned int i = 0 ; i < indexCrossover ; ++i)
-            offspringGenes.push_back(mumGenes[i]);
-
-        for (unsigned int i = indexCrossover ; i < nbGenes ; ++i)
-            offspringGenes.push_back(dadGenes[i]);
+        const double pointer = firstPointer + s / (double)nbSelections;
+        while (index < nbChromosomes-1 && this->m_selectingProba[index] < pointer)
+            ++index;
+        m_matingPool[s] = index;
     }
-    else    // Crossover with dad genes before
-    {
-        for (unsigned int i = 0 ; i < indexCrossover ; ++i)
-            offspringGenes.push_back(dadGenes[i]);
 
-        for (unsigned int i = indexCrossover ; i < nbGenes ; ++i)
-            offspringGenes.push_back(mumGenes[i]);
+    // Shuffle the pool, so that mates aren't neighbours on the wheel
+    for (unsigned int s = nbSelections-1 ; s > 0 ; --s)
+    {
+        std::uniform_int_distribution<unsigned int> distributionPosition(0, s);
+        std::swap(m_matingPool[s], m_matingPool[distributionPosition(generator)]);
     }
+}
+
+template<typename F, typename DATA, typename C>
+unsigned int RouletteWheel<F, DATA, C>::selectIndex(const unsigned int selection)
+{
+    if (selection < m_matingPool.size())
+        return m_matingPool[selection];
+    return selectOneIndex();
+}
 
-    // Set offspring genes
-    offspring.setDatas(offspringGenes);
+template<typename F, typename DATA, typename C>
+std::pair<C, C> RouletteWheel<F, DATA, C>::selectChromosomesPair()
+{
+    // Select 2 chromosomes based on their probability beteween [0, 1] to be selected
+    // It's the principle of roulette wheel, because chromosome with a better fitness
+    // Have larger interval of probability to be selected
+
+    // Select a chromosome mum and a chromosome dad
+    return std::pair< C, C >(selectOneChromosome(), selectOneChromosome());
+}
+
+template<typename F, typename DATA, typename C>
+C RouletteWheel<F, DATA, C>::crossOver(const std::pair<C, C>& parents)
+{
+    // Children Chromosome
+    C offspring;
+    crossOver(parents.first, parents.second, offspring);
 
     return offspring;
 }
 
+template<typename F, typename DATA, typename C>
+void RouletteWheel<F, DATA, C>::crossOver(const C& mum, const C& dad, C& offspring)
+{
+    offspring.crossOver(mum, dad);
+}
+
 template<typename F, typename DATA, typename C>
 std::vector< C > RouletteWheel<F, DATA, C>::getBestSolution() const
 {
@@ -202,13 +342,13 @@ std::vector< C > RouletteWheel<F, DATA, C>::getBestSolution() const
 }
 
 template<typename F, typename DATA, typename C>
-void RouletteWheel<F, DATA, C>::addKeptChromosomes(std::vector< C > chromosomes)
+void RouletteWheel<F, DATA, C>::addKeptChromosomes(std::vector< C >&& chromosomes)
 {
     // Fill the Population of chromosomes until it's full with chromosomes in parameter
     unsigned int i = 0;
     while (!this->isFull() && i < chromosomes.size())
     {
-        this->m_chromosomes.push_back(chromosomes[i]);
+        this->addChromosome(std::move(chromosomes[i]));
         ++i;
     }
 }
@@ -222,6 +362,7 @@ std::vector< C > RouletteWheel<F, DATA, C>::getKeptChromosomes()
     // Create a vector with the previous number of chromosome
     // Those which have the best fitness (so begin to the end of vector)
     std::vector< C > chromosomesKept;
+    chromosomesKept.reserve(nbChromosomesKeep);
     for (unsigned int i = 0 ; i < nbChromosomesKeep ; ++i)
         chromosomesKept.push_back(this->m_chromosomes[this->m_chromosomes.size()-(1+i)]);
     return chromosomesKept;
@@ -232,12 +373,8 @@ RouletteWheel<F, DATA, C>& RouletteWheel<F, DATA, C>::add(const RouletteWheel<F,
 {
     smoga::Population<F, DATA, C>::add(op);
 
-    this->m_cumulatedFitness.reserve(this->m_cumulatedFitness.size() + op.m_cumulatedFitness.size());
-    this->m_selectingProba.reserve(this->m_selectingProba.size() + op.m_selectingProba.size());
-    this->m_cumulatedFitness.insert(this->m_cumulatedFitness.end(), op.m_cumulatedFitness.begin(), op.m_cumulatedFitness.end());
-    this->m_selectingProba.insert(this->m_selectingProba.end(), op.m_selectingProba.begin(), op.m_selectingProba.end());
-
-    evaluateFitness();
+    // Chromosomes keep their fitness, only the wheel has to be built again
+    prepareSelection();
 
     return *this;
 }
@@ -1,22 +1,41 @@
 #ifndef TOURNAMENTM_H
 #define TOURNAMENTM_H
 
-#include <future>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
 
 #include "population.h"
 
 template<typename F, typename DATA, typename C>
 /**
  * @brief The TournamentM class Provide a selection of parents to breeding based on a Tournament and for Multi objective GA.
+ * The winner of a tournament among k chromosomes is the best one for the crowded comparison (rank, then crowding distance).
  */
 class TournamentM
         : public smoga::Population<F, DATA, C>
 {
 protected:
+    static unsigned int m_tournamentSize;   ///> Number of chromosomes competing in a tournament (k).
+    static bool m_withReplacement;          ///> Indicate if a chromosome can be drawn several times in the same tournament.
+
+    /**
+     * @brief isBetter Crowded comparison of two chromosomes of the population.
+     * @param index1 Index of the first chromosome.
+     * @param index2 Index of the second chromosome.
+     * @return true if (rank index1 < rank index2) or (rank index1 = rank index2 and distance index1 > distance index2).
+     */
+    inline bool isBetter(const unsigned int index1, const unsigned int index2) const
+    {
+        const C& chromosome1 = this->m_chromosomes[index1];
+        const C& chromosome2 = this->m_chromosomes[index2];
+        return chromosome1.getRank() < chromosome2.getRank()
+                || (chromosome1.getRank() == chromosome2.getRank() && chromosome1.getDistance() > chromosome2.getDistance());
+    }
 
     virtual void destroy();
     virtual void copy(const TournamentM<F, DATA, C> &other);
-    void computeFitnessForTheRange(const unsigned int begin, const unsigned int end);
 
 public:
     TournamentM(const int maxChromosome = -1);
@@ -24,16 +43,65 @@ public:
 
     virtual void evaluateFitness();
     virtual C selectOneChromosome();
+    virtual unsigned int selectOneIndex();
     virtual std::pair< C, C > selectChromosomesPair();
-    virtual C crossOver(const std::pair<C, C> parents);
+    virtual C crossOver(const std::pair<C, C>& parents);
+    virtual void crossOver(const C& mum, const C& dad, C& offspring);
     virtual std::vector< C > getBestSolution() const;
 
+    /**
+     * @brief setTournamentSize Set the number of chromosomes competing in a tournament.
+     * @param tournamentSize Number of chromosomes (k), at least 1.
+     */
+    static void setTournamentSize(const unsigned int tournamentSize) { m_tournamentSize = std::max(1u, tournamentSize); }
+    /**
+     * @brief getTournamentSize Get the number of chromosomes competing in a tournament.
+     * @return Number of chromosomes (k).
+     */
+    static unsigned int getTournamentSize() { return m_tournamentSize; }
+
+    /**
+     * @brief setWithReplacement Set if a chromosome can be drawn several times in the same tournament.
+     * @param withReplacement true to draw with replacement, false to draw k different chromosomes.
+     */
+    static void setWithReplacement(const bool withReplacement) { m_withReplacement = withReplacement; }
+    /**
+     * @brief getWithReplacement Get if a chromosome can be drawn several times in the same tournament.
+     * @return true if chromosomes are drawn with replacement.
+     */
+    static bool getWithReplacement() { return m_withReplacement; }
+
+    /**
+     * @brief writeCheckpointParameters Write the size of the tournaments and if chromosomes are drawn with replacement.
+     * @param checkpoint Checkpoint receiving the parameters.
+     */
+    static void writeCheckpointParameters(smoga::CheckpointWriter& checkpoint)
+    {
+        checkpoint.writeValue< uint32_t >(m_tournamentSize);
+        checkpoint.writeValue< uint8_t >(m_withReplacement);
+    }
+    /**
+     * @brief readCheckpointParameters Restore the parameters written by writeCheckpointParameters.
+     * @param checkpoint Checkpoint to read.
+     */
+    static void readCheckpointParameters(smoga::CheckpointReader& checkpoint)
+    {
+        setTournamentSize(checkpoint.readValue< uint32_t >());
+        setWithReplacement(checkpoint.readValue< uint8_t >() != 0);
+    }
+
     // Operator Like
     TournamentM& add(const TournamentM& op);
     // Operator
     TournamentM& operator=(const TournamentM& other);
 };
 
+// Init static variables
+template<typename F, typename DATA, typename C>
+unsigned int TournamentM<F, DATA, C>::m_tournamentSize = 2;
+template<typename F, typename DATA, typename C>
+bool TournamentM<F, DATA, C>::m_withReplacement = false;
+
 template<typename F, typename DATA, typename C>
 TournamentM<F, DATA, C>::TournamentM(const int maxChromosome)
     : smoga::Population<F, DATA, C>(maxChromosome == -1 ? this->m_sNbMaxChromosomes : maxChromosome)
@@ -60,51 +128,58 @@ void TournamentM<F, DATA, C>::copy(const TournamentM<F, DATA, C> &other)
 }
 
 template<typename F, typename DATA, typename C>
-void TournamentM<F, DATA, C>::computeFitnessForTheRange(const unsigned int begin, const unsigned int end)
+C TournamentM<F, DATA, C>::selectOneChromosome()
 {
-    for (unsigned int i = begin ; i <= end ; ++i)
-        this->m_chromosomes[i].computeFitness();
+    return this->m_chromosomes[selectOneIndex()];
 }
 
 template<typename F, typename DATA, typename C>
-C TournamentM<F, DATA, C>::selectOneChromosome()
+unsigned int TournamentM<F, DATA, C>::selectOneIndex()
 {
-    std::uniform_int_distribution<> distributionPoolSize(2, this->m_nbMaxChromosomes);
-    const unsigned int poolSize = distributionPoolSize(generator);
-    int proba[poolSize];
-
-    std::uniform_int_distribution<> distribution(0, this->m_nbMaxChromosomes-1);
-
-    int counter = 0;
-    bool equalIndex = false;
-    do{
-        // Generate random Index (different of of each other index already selected)
-        do{
-            equalIndex = false;
-            proba[counter] = distribution(generator);
-            for (int i = 0; i < counter; ++i)
-            {
-                if( proba[counter] == proba[i] )
-                {
-                    equalIndex = true;
-                    break;
-                }
-            }
-        } while( equalIndex );
-
-        counter++;
-
-    } while(counter != poolSize);
-
-    C chromosome = this->m_chromosomes[proba[0]];
-    for (unsigned int i = 0 ; i < poolSize ; ++i)
+    const unsigned int nbChromosomes = this->m_chromosomes.size();
+    if (nbChromosomes == 0)
+        throw std::runtime_error("Impossible to select a chromosome in an empty population!");
+
+    if (m_withReplacement)
+    {
+        std::uniform_int_distribution<unsigned int> distribution(0, nbChromosomes-1);
+        unsigned int winner = distribution(generator);
+        for (unsigned int i = 1 ; i < m_tournamentSize ; ++i)
+        {
+            const unsigned int candidate = distribution(generator);
+            if (isBetter(candidate, winner))
+                winner = candidate;
+        }
+        return winner;
+    }
+
+    // Without replacement : partial Fisher-Yates shuffle drawing the k first positions of a permutation of the indexes.
+    // Swaps are undone after the tournament, so that the permutation stays the identity and a tournament is in O(k)
+    static thread_local std::vector< unsigned int > permutation;
+    static thread_local std::vector< unsigned int > drawnPositions;
+    if (permutation.size() != nbChromosomes)
+    {
+        permutation.resize(nbChromosomes);
+        std::iota(permutation.begin(), permutation.end(), 0);
+    }
+
+    const unsigned int tournamentSize = std::min(m_tournamentSize, nbChromosomes);
+    drawnPositions.resize(tournamentSize);
+    unsigned int winner = 0;
+    for (unsigned int i = 0 ; i < tournamentSize ; ++i)
     {
-        if( this->m_chromosomes[proba[i]].getRank() < chromosome.getRank() // rank i < rank chromosome
-            || (this->m_chromosomes[proba[i]].getRank() == chromosome.getRank() && this->m_chromosomes[proba[i]].getDistance() > chromosome.getDistance())) // rank i == rank chromosome && dist i > dist chromosome
-            chromosome = this->m_chromosomes[proba[i]];
+        std::uniform_int_distribution<unsigned int> distribution(i, nbChromosomes-1);
+        drawnPositions[i] = distribution(generator);
+        std::swap(permutation[i], permutation[drawnPositions[i]]);
+
+        if (i == 0 || isBetter(permutation[i], winner))
+            winner = permutation[i];
     }
 
-    return chromosome;
+    for (unsigned int i = tournamentSize ; i > 0 ; --i)
+        std::swap(permutation[i-1], permutation[drawnPositions[i-1]]);
+
+    return winner;
 }
 
 template<typename F, typename DATA, typename C>
@@ -113,40 +188,7 @@ void TournamentM<F, DATA, C>::evaluateFitness()
     if (this->m_chromosomes.empty())
         return;
 
-    const unsigned int nbChromosomes = this->m_chromosomes.size();
-    /*const unsigned int maxNbThread = std::thread::hardware_concurrency();
-    if (maxNbThread > 2)    // Parallelize only if there are more than 2 cores
-    {
-        const unsigned int nbComputePerAsync = nbChromosomes/maxNbThread;
-
-        unsigned int begin = 0;
-        unsigned int end;
-        std::vector< std::future<void> > computeFitnessPartFunc;
-        for (unsigned int i = 0 ; i < maxNbThread ; ++i)
-        {
-            end = begin + nbComputePerAsync - 1;
-            if (i == maxNbThread-1)
-                end = nbChromosomes-1;
-
-            computeFitnessPartFunc.push_back(std::async(std::launch::async,
-                                                        [this](const unsigned int begin, const unsigned int end)
-                                                        {
-                                                            return this->computeFitnessForTheRange(begin, end);
-                                                        },
-                                                        begin,
-                                                        end));
-
-            begin += nbComputePerAsync;
-        }
-
-        for (unsigned int i = 0 ; i < maxNbThread ; ++i)
-            computeFitnessPartFunc[i].get();
-    }
-    else
-    {*/
-        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
-            this->m_chromosomes[i].computeFitness();
-    //}
+    this->computeFitnessOfChromosomes();
 }
 
 template<typename F, typename DATA, typename C>
@@ -156,51 +198,21 @@ std::pair< C, C > TournamentM<F, DATA, C>::selectChromosomesPair()
 }
 
 template<typename F, typename DATA, typename C>
-C TournamentM<F, DATA, C>::crossOver(const std::pair< C, C > parents)
+C TournamentM<F, DATA, C>::crossOver(const std::pair< C, C >& parents)
 {
     // Children Chromosome
     C offspring;
-
-    std::vector<int> offspringGenes;    // Children chromosome => will be fill
-    // Get parents genes
-    std::vector<int> mumGenes = parents.first.getDatas();
-    std::vector<int> dadGenes = parents.second.getDatas();
-
-    // According to crossover probability it's the dad or mum that will begin to fill offspring genes
-    std::uniform_real_distribution<float> distribution(0.0, 1.0);
-    float probaCrossOver = distribution(generator);
-
-    const unsigned int nbGenes = C::getNbGenes();
-    if (nbGenes == 0)
-        return offspring;
-
-    // Random number to define on which genes crossover begin
-    std::uniform_int_distribution<> distributionInt(0, C::getNbGenes()-1);
-    const unsigned int indexCrossover = distributionInt(generator);
-
-    if (probaCrossOver <= 0.5)  // Take mum genes before dad, with 1/2
-    {
-        for (unsigned int i = 0 ; i < indexCrossover ; ++i)
-            offspringGenes.push_back(mumGenes[i]);
-
-        for (unsigned int i = indexCrossover ; i < nbGenes ; ++i)
-            offspringGenes.push_back(dadGenes[i]);
-    }
-    else    // Take dad genes before mum
-    {
-        for (unsigned int i = 0 ; i < indexCrossover ; ++i)
-            offspringGenes.push_back(dadGenes[i]);
-
-        for (unsigned int i = indexCrossover ; i < nbGenes ; ++i)
-            offspringGenes.push_back(mumGenes[i]);
-    }
-
-    // Set offspring genes
-    offspring.setDatas(offspringGenes);
+    crossOver(parents.first, parents.second, offspring);
 
     return offspring;
 }
 
+template<typename F, typename DATA, typename C>
+void TournamentM<F, DATA, C>::crossOver(const C& mum, const C& dad, C& offspring)
+{
+    offspring.crossOver(mum, dad);
+}
+
 template<typename F, typename DATA, typename C>
 std::vector< C > TournamentM<F, DATA, C>::getBestSolution() const
 {
@@ -210,10 +222,9 @@ std::vector< C > TournamentM<F, DATA, C>::getBestSolution() const
 template<typename F, typename DATA, typename C>
 TournamentM<F, DATA, C>& TournamentM<F, DATA, C>::add(const TournamentM& op)
 {
+    // Chromosomes keep their fitness, there is nothing to evaluate again
     smoga::Population<F, DATA, C>::add(op);
 
-    evaluateFitness();
-
     return *this;
 }
 
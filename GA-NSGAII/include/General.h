@@ -10,6 +10,9 @@
 #include <fstream>
 #include <algorithm>
 #include <limits>
+#include <cstdint>
+
+#include "random.h"
 
 /////////////////////////////////////////////////////////////
 //////////////////////// Declarations ///////////////////////
@@ -68,6 +71,27 @@ struct CrowdingOperator
     }
 };
 
+template<typename T>
+/**
+ * @brief The CrowdingIndexOperator struct Compare 2 indexes of chromosomes of a population according to their crowding distance and rank.
+ */
+struct CrowdingIndexOperator
+{
+    const T* population;    ///> Population containing the chromosomes
+    /**
+     * @brief operator() Compare the 2 chromosomes at the indexes in parameter according to their crowding distance and rank.
+     * @param index1 Index of the first Operand.
+     * @param index2 Index of the second Operand.
+     * @return true if (rank index1 < rank index2) or (rank index1 = rank index2 and distance index1 > distance index2), otherwise return false.
+     */
+    bool operator()(const unsigned int index1, const unsigned int index2) const
+    {
+        return (population->getChromosome(index1).getRank() < population->getChromosome(index2).getRank())
+                || (population->getChromosome(index1).getRank() == population->getChromosome(index2).getRank()
+                    && population->getChromosome(index1).getDistance() > population->getChromosome(index2).getDistance());
+    }
+};
+
 template<typename T>
 /**
  * @brief The Ascending struct Use to perform comparisons pair by pair in ascending order.
@@ -123,7 +147,7 @@ template <typename T>
  * @param binary Vector of bits.
  * @return Integer decimal number.
  */
-int getIntegerFromBinary(const std::vector<T> binary);
+int getIntegerFromBinary(const std::vector<T>& binary);
 
 template <typename T>
 /**
@@ -131,15 +155,16 @@ template <typename T>
  * @param binary Vector of bits.
  * @return Unsigned integer decimal number.
  */
-unsigned int getUnsignedIntegerFromBinary(const std::vector<T> binary);
+unsigned int getUnsignedIntegerFromBinary(const std::vector<T>& binary);
 
 template <typename T>
 /**
  * @brief getDoubleFromBinary Compute the double decimal number corresponding to the parameter.
- * @param binary Vector of bits (first 60% of bits correspond to the entire part of the number).
+ * Bits after the sign are gathered with shifts in a fixed-point integer, scaled by a power of 2 (see smoga::BinaryDecoder for several variables).
+ * @param binary Vector of bits (first bit is the sign, then 60% of bits correspond to the entire part of the number).
  * @return Double decimal number.
  */
-double getDoubleFromBinary(const std::vector<T> binary);
+double getDoubleFromBinary(const std::vector<T>& binary);
 
 /**
  * @brief power Compute the number nb^pow.
@@ -163,6 +188,35 @@ union number
 void display(double d);
 void display(union number n);
 
+/**
+ * @brief powerOfTwo Compute 2^exponent exactly, by writing the exponent in the bits of a double.
+ * @param exponent Exponent between -1022 and 1023.
+ * @return 2^exponent.
+ */
+inline double powerOfTwo(const int exponent)
+{
+    union number n;
+    n.i = uint64_t(1023 + exponent) << 52;
+    return n.d;
+}
+
+/**
+ * @brief popCount Count the number of bits set to 1 in a word.
+ * @param word Word to check.
+ * @return Number of bits set to 1.
+ */
+inline unsigned int popCount(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(word);
+#else
+    unsigned int count = 0;
+    for ( ; word ; ++count)
+        word &= word - 1;
+    return count;
+#endif
+}
+
 class PairMinMax
 {
 public:
@@ -187,10 +241,6 @@ inline T floorValue(const T& value, int nbDecimal);
 template <typename T>
 T extractNumberFromStr(const std::string& str);
 
-// Random number generator
-// Other possible seed : std::chrono::system_clock::now().time_since_epoch().count()
-static std::mt19937 generator(686452231);
-
 /////////////////////////////////////////////////////////////
 //////////////////////// Definitions ////////////////////////
 /////////////////////////////////////////////////////////////
@@ -211,16 +261,12 @@ T getNumber(const std::string& s)
 }
 
 template <typename T>
-int getIntegerFromBinary(const std::vector<T> binary)
+int getIntegerFromBinary(const std::vector<T>& binary)
 {
     int value = 0;
-    int index = 0;
-    for (unsigned int i = binary.size()-1 ; i >= 1 ; --i)
-    {
-        if (binary[i] == 1)
-            value += power(2, index);
-        index++;
-    }
+    const unsigned int nbBits = binary.size();
+    for (unsigned int i = 1 ; i < nbBits ; ++i)
+        value |= int(binary[i] == 1) << (nbBits - 1 - i);
 
     if (binary[0] == 1)
         value = -value;
@@ -229,41 +275,19 @@ int getIntegerFromBinary(const std::vector<T> binary)
 }
 
 template <typename T>
-unsigned int getUnsignedIntegerFromBinary(const std::vector<T> binary)
+unsigned int getUnsignedIntegerFromBinary(const std::vector<T>& binary)
 {
     unsigned int value = 0;
-    int index = 0;
-    for (int i = binary.size()-1 ; i >= 0 ; --i)
-    {
-        if (binary[i] == 1)
-            value += power(2, index);
-        index++;
-    }
+    const unsigned int nbBits = binary.size();
+    for (unsigned int i = 0 ; i < nbBits ; ++i)
+        value |= (unsigned int)(binary[i] == 1) << (nbBits - 1 - i);
 
     return value;
 }
 
 template <typename T>
-double getDoubleFromBinary(const std::vector<T> binary)
+double getDoubleFromBinary(const std::vector<T>& binary)
 {
-    /*char base_bin[binary.size()];
-
-    for (unsigned int i = 0 ; i < binary.size() ; i++)
-        base_bin[i] = binary[i] + '0';
-
-    //char base_bin[]  = "0011111110010100011110101110000101000111101011100001010001111011";
-    //char base_bin[]  = "0011111111110000000000000000000000000000000000000000000000000000";
-
-    unsigned long int x;
-    unsigned long long int value = 0;
-    for (x = 0 ; x < sizeof(base_bin)-1 ; ++x)
-    {
-        value<<=1;
-        value|=base_bin[x]&1;
-    }
-
-    return *(double *)&value;*/
-
     const unsigned int nbBits = binary.size();
     double value = 0;
 
@@ -274,34 +298,34 @@ double getDoubleFromBinary(const std::vector<T> binary)
         else
             return 1;
     }
-    else if (nbBits == 2)
-    {
-        if (binary[1] == 1)
-            value = 1;
-
-        if (binary[0] == 1)
-            return -value;
-        return value;
-    }
 
     const unsigned int beforeDecimalPoint = 0.6*nbBits;
+    const int nbFractionBits = nbBits - 1 - beforeDecimalPoint;
 
-    // Entire part
-    int index = 0;
-    for (unsigned int i = beforeDecimalPoint ; i >= 1 ; --i)
+    if (nbBits - 1 <= 53)
     {
-        if (binary[i] == 1)
-            value += power(2, index);
-        index++;
+        // All bits fit in the mantissa of a double : gather them with shifts in a fixed-point integer, then scale it once (exact).
+        // Entire part is read from its first bit, fractional part from the last bit (weight 2^-1).
+        uint64_t fixedPoint = 0;
+        for (unsigned int i = 1 ; i <= beforeDecimalPoint ; ++i)
+            fixedPoint |= uint64_t(binary[i] == 1) << (nbBits - 1 - i);
+        for (unsigned int i = beforeDecimalPoint + 1 ; i < nbBits ; ++i)
+            fixedPoint |= uint64_t(binary[i] == 1) << (i - beforeDecimalPoint - 1);
+        value = double(fixedPoint) * powerOfTwo(-nbFractionBits);
     }
-
-    // After decimal point part
-    index = 1;
-    for (int i = nbBits-1 ; i > beforeDecimalPoint ; --i)
+    else
     {
-        if (binary[i] == 1)
-            value += power(2.0, -index);
-        index++;
+        // Rounded in the same order as summing each bit's power of 2, from the smallest entire one
+        for (unsigned int i = beforeDecimalPoint ; i >= 1 ; --i)
+        {
+            if (binary[i] == 1)
+                value += powerOfTwo(beforeDecimalPoint - i);
+        }
+        for (unsigned int i = nbBits-1 ; i > beforeDecimalPoint ; --i)
+        {
+            if (binary[i] == 1)
+                value += powerOfTwo(int(i) - int(nbBits));
+        }
     }
 
     if (binary[0] == 1)
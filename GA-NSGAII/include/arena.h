@@ -0,0 +1,121 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <vector>
+#include <cstddef>
+#include <mutex>
+
+namespace smoga
+{
+
+    /**
+     * @brief The Arena class Provide memory by bumping an offset in big blocks, all memory being released at once by reset.
+     * Blocks are kept between resets, and merged in a single one when several have been needed, so that a computation
+     * done again and again (ex : one generation) only allocates memory the first times.
+     * Allocations are protected by a mutex, so tasks of a ThreadPool can share an arena.
+     */
+    class Arena
+    {
+    protected:
+        /**
+         * @brief The Block struct Memory block of the arena.
+         */
+        struct Block
+        {
+            char* datas;        ///> Memory of the block.
+            std::size_t size;   ///> Size of the block in bytes.
+        };
+
+        std::vector< Block > m_blocks;  ///> Blocks of the arena.
+        unsigned int m_currentBlock;    ///> Block in which memory is currently taken.
+        std::size_t m_offset;           ///> Offset of the free memory in the current block.
+        std::size_t m_blockSize;        ///> Minimal size of a new block.
+        std::mutex m_mutex;             ///> Protect the blocks and the offset.
+
+        /**
+         * @brief addBlock Allocate a new block at the end of m_blocks.
+         * @param size Size of the block in bytes.
+         */
+        void addBlock(const std::size_t size);
+
+        /**
+         * @brief releaseBlocks Free all blocks.
+         */
+        void releaseBlocks();
+
+    public:
+        /**
+         * @brief Arena Create an arena without memory, the first block being allocated by the first allocation.
+         * @param blockSize Minimal size of a block in bytes.
+         */
+        Arena(const std::size_t blockSize = 65536);
+        Arena(const Arena& other) = delete;
+        virtual ~Arena();
+
+        Arena& operator=(const Arena& other) = delete;
+
+        /**
+         * @brief allocate Take memory in the arena, it's valid until the next reset or the destruction of the arena.
+         * @param size Size in bytes.
+         * @param alignment Alignment of the memory, a power of 2 not greater than alignof(std::max_align_t).
+         * @return Pointer on the memory.
+         */
+        void* allocate(const std::size_t size, const std::size_t alignment = alignof(std::max_align_t));
+
+        /**
+         * @brief reset Release all memory taken in the arena at once, blocks being kept for the next allocations.
+         */
+        void reset();
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getCapacity Get the memory owned by the arena.
+         * @return Sum of the size of all blocks in bytes.
+         */
+        std::size_t getCapacity() const;
+    };
+
+    template<typename T>
+    /**
+     * @brief The ArenaAllocator class Allocator taking memory in an Arena, to be used with standard containers.
+     * Deallocation does nothing, memory being released by Arena::reset, so containers must not be used after it.
+     */
+    class ArenaAllocator
+    {
+    protected:
+        Arena* m_arena; ///> Arena providing memory (not owned).
+
+    public:
+        typedef T value_type;
+
+        ArenaAllocator(Arena* arena) : m_arena(arena) {}
+        template<typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) : m_arena(other.getArena()) {}
+
+        /**
+         * @brief allocate Take memory for number objects in the arena.
+         * @param number Number of objects.
+         * @return Pointer on the first object.
+         */
+        T* allocate(const std::size_t number) { return static_cast<T*>(m_arena->allocate(number * sizeof(T), alignof(T))); }
+        /**
+         * @brief deallocate Do nothing, memory is released by Arena::reset.
+         */
+        void deallocate(T*, const std::size_t) {}
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getArena Get the arena providing memory.
+         * @return The arena.
+         */
+        inline Arena* getArena() const { return m_arena; }
+    };
+
+    template<typename T, typename U>
+    bool operator==(const ArenaAllocator<T>& allocator1, const ArenaAllocator<U>& allocator2) { return allocator1.getArena() == allocator2.getArena(); }
+    template<typename T, typename U>
+    bool operator!=(const ArenaAllocator<T>& allocator1, const ArenaAllocator<U>& allocator2) { return allocator1.getArena() != allocator2.getArena(); }
+
+}
+
+#endif // ARENA_H
@@ -0,0 +1,111 @@
+#ifndef ASYNCRUNLOGWRITER_H
+#define ASYNCRUNLOGWRITER_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "runlog.h"
+
+namespace smoga
+{
+
+    /**
+     * @brief The AsyncRunLogWriter class Run log whose records are written in the file by a background thread.
+     * The engine serializes each generation in a record buffer, an immutable snapshot handed to the writer thread through a bounded queue,
+     * and continues with another buffer taken from the ones already written, so that the GA loop never waits for the disk
+     * unless the BLOCK policy is chosen and the queue is full.
+     */
+    class AsyncRunLogWriter
+            : public RunLogWriter
+    {
+    public:
+        /**
+         * @brief The Policy enum Behaviour when a generation is logged while the queue is full.
+         */
+        enum Policy
+        {
+            BLOCK,  ///> Wait until the writer thread frees a place, no generation is lost.
+            DROP,   ///> Skip the generation, counted in getNbDroppedGenerations.
+            SAMPLE  ///> Only log one generation every getSamplingInterval, waiting like BLOCK if the queue is still full.
+        };
+
+    protected:
+        Policy m_policy;                                ///> Behaviour when the queue is full.
+        unsigned int m_queueCapacity;                   ///> Number maximum of records waiting to be written.
+        unsigned int m_samplingInterval;                ///> Interval between 2 logged generations with SAMPLE.
+        uint64_t m_nbDroppedGenerations;                ///> Number of generations skipped because the queue was full.
+
+        std::deque< std::vector< char > > m_queue;      ///> Records waiting to be written, in order.
+        std::vector< std::vector< char > > m_freeBuffers;  ///> Buffers already written, reused for the next records.
+        bool m_isWriting;                               ///> Indicate that the writer thread is writing a record.
+        bool m_stop;                                    ///> Indicate that the writer thread must stop once the queue is empty.
+        std::mutex m_mutex;                             ///> Protect the queue, the free buffers and the flags.
+        std::condition_variable m_recordQueued;         ///> Notified when a record is queued or the writer must stop.
+        std::condition_variable m_recordWritten;        ///> Notified when the writer thread has written a record.
+        std::thread m_writer;                           ///> Thread writing the records.
+
+        /**
+         * @brief flushBuffer Queue m_buffer (one record, or the header) for the writer thread and replace it by a free buffer.
+         */
+        virtual void flushBuffer();
+
+        /**
+         * @brief writeRecords Loop of the writer thread.
+         */
+        void writeRecords();
+
+    public:
+        /**
+         * @brief AsyncRunLogWriter Create the file of a run log and start its writer thread.
+         * @param fileName Name of the file, replaced if it exists.
+         * @param header Header of the run log (see makeRunLogHeader).
+         * @param queueCapacity Number maximum of records waiting to be written (at least 1).
+         * @param policy Behaviour when a generation is logged while the queue is full.
+         * @param samplingInterval Interval between 2 logged generations with SAMPLE (generations multiple of it are logged).
+         */
+        AsyncRunLogWriter(const std::string& fileName, const RunLogHeader& header, const unsigned int queueCapacity = 4,
+                          const Policy policy = BLOCK, const unsigned int samplingInterval = 1);
+        virtual ~AsyncRunLogWriter();
+
+        /**
+         * @brief beginGeneration Begin the record of a generation, unless it's not sampled or dropped because the queue is full.
+         * @param generation Index of the generation.
+         * @param nbChromosomes Number of chromosomes of the generation.
+         * @return false if the generation isn't logged.
+         */
+        virtual bool beginGeneration(const uint32_t generation, const uint32_t nbChromosomes);
+
+        /**
+         * @brief flush Wait until all queued records have been written in the file.
+         */
+        virtual void flush();
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getPolicy Get the behaviour when a generation is logged while the queue is full.
+         * @return The policy.
+         */
+        inline Policy getPolicy() const { return m_policy; }
+        /**
+         * @brief getQueueCapacity Get the number maximum of records waiting to be written.
+         * @return Capacity of the queue.
+         */
+        inline unsigned int getQueueCapacity() const { return m_queueCapacity; }
+        /**
+         * @brief getSamplingInterval Get the interval between 2 logged generations with SAMPLE.
+         * @return Sampling interval.
+         */
+        inline unsigned int getSamplingInterval() const { return m_samplingInterval; }
+        /**
+         * @brief getNbDroppedGenerations Get the number of generations skipped because the queue was full (DROP).
+         * @return Number of dropped generations.
+         */
+        uint64_t getNbDroppedGenerations();
+    };
+
+}
+
+#endif // ASYNCRUNLOGWRITER_H
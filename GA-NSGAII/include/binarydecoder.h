@@ -0,0 +1,237 @@
+#ifndef BINARYDECODER_H
+#define BINARYDECODER_H
+
+#include <vector>
+#include <cstdint>
+#include <stdexcept>
+
+namespace smoga
+{
+
+    /**
+     * @brief The BinaryDecoder class Decode the real variables encoded in the bits of a genome.
+     * Each variable is a field of consecutive genes, gathered with shifts in a fixed-point integer, optionally Gray-decoded,
+     * then scaled by a factor computed when the variable is added, so that decoding does neither loop on powers nor branch on bits.
+     * Genes are bits stored one by gene (ex : Chromosome<F, int>) or packed in 64 bits words (BitStringChromosome).
+     */
+    class BinaryDecoder
+    {
+    public:
+        /**
+         * @brief The Encoding enum Way a variable is encoded in its bits.
+         */
+        enum Encoding
+        {
+            FIXED_POINT,    ///> Sign bit, then 60% of bits for the entire part and the fractional part read from the last bit, like getDoubleFromBinary.
+            RANGE           ///> Unsigned integer (first bit is the most significant) mapped linearly on [min, max].
+        };
+
+    protected:
+        /**
+         * @brief The Segment struct Consecutive genes giving consecutive bits of the fixed-point integer of a variable.
+         */
+        struct Segment
+        {
+            unsigned int firstGene; ///> Index of the first gene of the segment.
+            unsigned int nbBits;    ///> Number of genes of the segment.
+            bool firstIsMost;       ///> Indicate that the first gene is the most significant bit, otherwise the least significant one.
+            unsigned int shift;     ///> Position of the least significant bit of the segment in the fixed-point integer.
+        };
+
+        /**
+         * @brief The Variable struct Field of the genome encoding a variable, with its precomputed scale.
+         */
+        struct Variable
+        {
+            Encoding encoding;      ///> Encoding of the variable.
+            bool gray;              ///> Indicate that the fixed-point integer is Gray-coded.
+            bool hasSign;           ///> Indicate that the first gene of the variable is a sign bit.
+            unsigned int signGene;  ///> Index of the sign bit.
+            unsigned int nbBits;    ///> Number of bits of the fixed-point integer.
+            Segment segments[2];    ///> Segments composing the fixed-point integer.
+            unsigned int nbSegments;///> Number of segments used.
+            double offset;          ///> Value of a null fixed-point integer.
+            double scale;           ///> Value of the least significant bit of the fixed-point integer.
+        };
+
+        std::vector< Variable > m_variables;    ///> Variables in the order of decoding.
+        unsigned int m_nbGenes;                 ///> Number of genes used by all variables.
+
+        /**
+         * @brief addSegment Add a segment to a variable, its genes following the previous ones.
+         * @param variable Variable to complete.
+         * @param nbBits Number of genes of the segment.
+         * @param firstIsMost Indicate that the first gene is the most significant bit.
+         * @param shift Position of the least significant bit of the segment in the fixed-point integer.
+         */
+        void addSegment(Variable& variable, const unsigned int nbBits, const bool firstIsMost, const unsigned int shift);
+
+        /**
+         * @brief toValue Compute the value of a variable from its fixed-point integer.
+         * @param variable Variable decoded.
+         * @param fixedPoint Fixed-point integer read in the genes.
+         * @param negative Indicate that the sign bit is set.
+         * @return Value of the variable.
+         */
+        static inline double toValue(const Variable& variable, uint64_t fixedPoint, const bool negative)
+        {
+            if (variable.gray)
+                fixedPoint = grayToBinary(fixedPoint);
+            const double value = variable.offset + double(fixedPoint) * variable.scale;
+            return negative ? -value : value;
+        }
+
+    public:
+        BinaryDecoder();
+
+        /**
+         * @brief addFixedPointVariable Add a variable encoded like getDoubleFromBinary, in the genes following the previous variables.
+         * @param nbBits Number of genes of the variable, sign included (at most 54).
+         * @param gray Indicate that the bits after the sign are Gray-coded.
+         * @return Index of the variable.
+         */
+        unsigned int addFixedPointVariable(const unsigned int nbBits, const bool gray = false);
+        /**
+         * @brief addRangeVariable Add a variable mapped on [min, max], in the genes following the previous variables.
+         * @param nbBits Number of genes of the variable (at most 53, so that each value is exact).
+         * @param min Value of the bits all set to 0.
+         * @param max Value of the bits all set to 1.
+         * @param gray Indicate that the bits are Gray-coded.
+         * @return Index of the variable.
+         */
+        unsigned int addRangeVariable(const unsigned int nbBits, const double min, const double max, const bool gray = false);
+
+        template<typename T>
+        /**
+         * @brief decode Decode all variables from genes stored one by gene, a gene equal to 1 being a set bit.
+         * @param genes Genes of the genome (at least getNbGenes()).
+         * @param values Values of the variables (getNbVariables()).
+         */
+        void decode(const T* genes, double* values) const;
+        template<typename T>
+        /**
+         * @brief decode Decode all variables from genes stored one by gene, a gene equal to 1 being a set bit.
+         * @param genes Genes of the genome.
+         * @param values Values of the variables, resized to getNbVariables().
+         */
+        void decode(const std::vector<T>& genes, std::vector<double>& values) const;
+        template<typename T>
+        /**
+         * @brief decodeBatch Decode all variables of several genomes, like the genes matrix of Population::gatherGenes.
+         * @param genes Genes of the genomes, genome i in [i*nbGenes, (i+1)*nbGenes[.
+         * @param nbGenes Number of genes of each genome.
+         * @param nbGenomes Number of genomes.
+         * @param values Values of the variables, genome i in [i*getNbVariables(), (i+1)*getNbVariables()[.
+         */
+        void decodeBatch(const T* genes, const unsigned int nbGenes, const unsigned int nbGenomes, double* values) const;
+
+        /**
+         * @brief decodePacked Decode all variables from genes packed in 64 bits words, gene i being bit i%64 of word i/64.
+         * Each segment is extracted by shifting one or two words and reversed with a few masks when needed.
+         * @param words Words of the genome (ex : BitStringChromosome::getDatas()).
+         * @param values Values of the variables (getNbVariables()).
+         */
+        void decodePacked(const uint64_t* words, double* values) const;
+
+        /**
+         * @brief grayToBinary Convert a Gray-coded integer in binary (each bit is the xor of the more significant Gray bits).
+         * @param gray Gray-coded integer.
+         * @return Binary integer.
+         */
+        static inline uint64_t grayToBinary(uint64_t gray)
+        {
+            gray ^= gray >> 1;
+            gray ^= gray >> 2;
+            gray ^= gray >> 4;
+            gray ^= gray >> 8;
+            gray ^= gray >> 16;
+            gray ^= gray >> 32;
+            return gray;
+        }
+
+        /**
+         * @brief reverseBits Reverse the order of the low bits of a word.
+         * @param word Word whose bits above nbBits are 0.
+         * @param nbBits Number of bits to reverse (between 1 and 64).
+         * @return Word whose bit i is bit nbBits-1-i of word.
+         */
+        static inline uint64_t reverseBits(uint64_t word, const unsigned int nbBits)
+        {
+            word = ((word >> 1) & 0x5555555555555555ULL) | ((word & 0x5555555555555555ULL) << 1);
+            word = ((word >> 2) & 0x3333333333333333ULL) | ((word & 0x3333333333333333ULL) << 2);
+            word = ((word >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((word & 0x0F0F0F0F0F0F0F0FULL) << 4);
+#if defined(__GNUC__) || defined(__clang__)
+            word = __builtin_bswap64(word);
+#else
+            word = ((word >> 8) & 0x00FF00FF00FF00FFULL) | ((word & 0x00FF00FF00FF00FFULL) << 8);
+            word = ((word >> 16) & 0x0000FFFF0000FFFFULL) | ((word & 0x0000FFFF0000FFFFULL) << 16);
+            word = (word >> 32) | (word << 32);
+#endif
+            return word >> (64 - nbBits);
+        }
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getNbVariables Get the number of variables decoded.
+         * @return Number of variables.
+         */
+        inline unsigned int getNbVariables() const { return m_variables.size(); }
+        /**
+         * @brief getNbGenes Get the number of genes used by all variables.
+         * @return Number of genes.
+         */
+        inline unsigned int getNbGenes() const { return m_nbGenes; }
+    };
+
+    template<typename T>
+    void BinaryDecoder::decode(const T* genes, double* values) const
+    {
+        for (unsigned int v = 0 ; v < m_variables.size() ; ++v)
+        {
+            const Variable& variable = m_variables[v];
+
+            // Each bit is shifted at its place, so iterations are independent
+            uint64_t fixedPoint = 0;
+            for (unsigned int s = 0 ; s < variable.nbSegments ; ++s)
+            {
+                const Segment& segment = variable.segments[s];
+                const T* bits = genes + segment.firstGene;
+                if (segment.firstIsMost)
+                {
+                    for (unsigned int i = 0 ; i < segment.nbBits ; ++i)
+                        fixedPoint |= uint64_t(bits[i] == 1) << (segment.shift + segment.nbBits - 1 - i);
+                }
+                else
+                {
+                    for (unsigned int i = 0 ; i < segment.nbBits ; ++i)
+                        fixedPoint |= uint64_t(bits[i] == 1) << (segment.shift + i);
+                }
+            }
+
+            values[v] = toValue(variable, fixedPoint, variable.hasSign && genes[variable.signGene] == 1);
+        }
+    }
+
+    template<typename T>
+    void BinaryDecoder::decode(const std::vector<T>& genes, std::vector<double>& values) const
+    {
+        if (genes.size() < m_nbGenes)
+            throw std::runtime_error("Not enough genes to decode all variables!");
+
+        values.resize(m_variables.size());
+        decode(genes.data(), values.data());
+    }
+
+    template<typename T>
+    void BinaryDecoder::decodeBatch(const T* genes, const unsigned int nbGenes, const unsigned int nbGenomes, double* values) const
+    {
+        if (nbGenes < m_nbGenes)
+            throw std::runtime_error("Not enough genes to decode all variables!");
+
+        for (unsigned int g = 0 ; g < nbGenomes ; ++g)
+            decode(genes + g*nbGenes, values + g*m_variables.size());
+    }
+
+}
+
+#endif // BINARYDECODER_H
@@ -0,0 +1,231 @@
+#ifndef BITSTRINGCHROMOSOME_H
+#define BITSTRINGCHROMOSOME_H
+
+#include <cstdint>
+
+#include "General.h"
+#include "chromosome.h"
+
+namespace smoga
+{
+
+    template<typename F>
+    /**
+     * @brief The BitStringChromosome class Provide a binary chromosome packing its genes in 64 bits words.
+     * The number of genes (m_nbGenes) is the number of bits, bits after the last gene are always 0.
+     * Crossover copies whole words and mutation only draws the positions of the flipped bits.
+     * computeFitness is left to the problem, countOnes can help (ex : OneMax).
+     */
+    class BitStringChromosome
+            : public Chromosome<F, uint64_t>
+    {
+    protected:
+        static double m_mutateProbability;  ///> Probability for each bit to be flipped by a mutation (1/m_nbGenes if negative).
+
+        /**
+         * @brief lastWordMask Get the mask of the bits of the last word which are genes.
+         * @return Mask of the last word.
+         */
+        static inline uint64_t lastWordMask()
+        {
+            const unsigned int nbBitsInLastWord = Chromosome<F, uint64_t>::m_nbGenes % 64;
+            return nbBitsInLastWord == 0 ? ~uint64_t(0) : (uint64_t(1) << nbBitsInLastWord) - 1;
+        }
+
+    public:
+        BitStringChromosome();
+
+        /**
+         * @brief mutate Flip each bit with the probability getMutateProbability(),
+         * by jumping from a flipped bit to the next one with a geometric distribution.
+         * @return true if at least one bit has been flipped.
+         */
+        virtual bool mutate();
+
+        /**
+         * @brief generateRandomChromosome Generate random bits for all genes.
+         */
+        virtual void generateRandomChromosome();
+
+        /**
+         * @brief crossOver Set the bits of the chromosome to a one point crossover of the bits of mum and dad,
+         * the bits of mum or dad being taken first with a probability of 1/2. Only the word of the crossover point is masked.
+         * @param mum First parent.
+         * @param dad Second parent.
+         */
+        void crossOver(const BitStringChromosome& mum, const BitStringChromosome& dad);
+
+        /**
+         * @brief countOnes Count the number of bits set to 1.
+         * @return Number of bits set to 1.
+         */
+        unsigned int countOnes() const;
+
+        virtual std::string datasToStr();
+
+        ////////////// Accessor/Setters //////////////
+        /**
+         * @brief getBit Get the value of a gene.
+         * @param index Index of the gene.
+         * @return Value of the gene.
+         */
+        inline bool getBit(const unsigned int index) const { return (this->m_datas[index >> 6] >> (index & 63)) & 1; }
+        /**
+         * @brief setBit Set the value of a gene.
+         * @param index Index of the gene.
+         * @param value Value of the gene.
+         */
+        inline void setBit(const unsigned int index, const bool value)
+        {
+            const uint64_t mask = uint64_t(1) << (index & 63);
+            if (value)
+                this->m_datas[index >> 6] |= mask;
+            else
+                this->m_datas[index >> 6] &= ~mask;
+        }
+        /**
+         * @brief flipBit Flip the value of a gene.
+         * @param index Index of the gene.
+         */
+        inline void flipBit(const unsigned int index) { this->m_datas[index >> 6] ^= uint64_t(1) << (index & 63); }
+
+        /**
+         * @brief getNbWords Get the number of words needed to store m_nbGenes bits.
+         * @return Number of words.
+         */
+        static inline unsigned int getNbWords() { return (Chromosome<F, uint64_t>::m_nbGenes + 63) / 64; }
+
+        /**
+         * @brief setMutateProbability Set the probability for each bit to be flipped by a mutation.
+         * @param mutateProbability Probability for each bit, a negative value to use 1/m_nbGenes.
+         */
+        static void setMutateProbability(const double mutateProbability) { m_mutateProbability = mutateProbability; }
+        /**
+         * @brief getMutateProbability Get the probability for each bit to be flipped by a mutation.
+         * @return Probability for each bit.
+         */
+        static double getMutateProbability()
+        {
+            if (m_mutateProbability >= 0)
+                return m_mutateProbability;
+            return Chromosome<F, uint64_t>::m_nbGenes == 0 ? 0 : 1.0 / Chromosome<F, uint64_t>::m_nbGenes;
+        }
+
+        /**
+         * @brief writeCheckpointParameters Write the probability for each bit to be flipped.
+         * @param checkpoint Checkpoint receiving the parameters.
+         */
+        static void writeCheckpointParameters(CheckpointWriter& checkpoint) { checkpoint.writeValue< double >(m_mutateProbability); }
+        /**
+         * @brief readCheckpointParameters Restore the probability written by writeCheckpointParameters.
+         * @param checkpoint Checkpoint to read.
+         */
+        static void readCheckpointParameters(CheckpointReader& checkpoint) { m_mutateProbability = checkpoint.readValue< double >(); }
+    };
+
+    template<typename F>
+    double BitStringChromosome<F>::m_mutateProbability = -1;
+
+    template<typename F>
+    BitStringChromosome<F>::BitStringChromosome()
+        : Chromosome<F, uint64_t>()
+    {
+    }
+
+    template<typename F>
+    bool BitStringChromosome<F>::mutate()
+    {
+        const double proba = getMutateProbability();
+        const unsigned int nbGenes = this->m_nbGenes;
+        if (proba <= 0 || nbGenes == 0 || this->m_datas.empty())
+            return false;
+
+        if (proba >= 1)
+        {
+            for (unsigned int w = 0 ; w < this->m_datas.size() ; ++w)
+                this->m_datas[w] = ~this->m_datas[w];
+            this->m_datas.back() &= lastWordMask();
+            return true;
+        }
+
+        // Number of bits skipped before the next flipped bit
+        std::geometric_distribution<uint64_t> distribution(proba);
+        bool flag = false;
+        for (uint64_t i = distribution(generator) ; i < nbGenes ; i += 1 + distribution(generator))
+        {
+            flipBit(i);
+            flag = true;
+        }
+
+        return flag;
+    }
+
+    template<typename F>
+    void BitStringChromosome<F>::generateRandomChromosome()
+    {
+        const unsigned int nbWords = getNbWords();
+        this->m_datas.resize(nbWords);
+        for (unsigned int w = 0 ; w < nbWords ; ++w)
+            this->m_datas[w] = (uint64_t(generator()) << 32) | generator();
+
+        if (nbWords != 0)
+            this->m_datas.back() &= lastWordMask();
+    }
+
+    template<typename F>
+    void BitStringChromosome<F>::crossOver(const BitStringChromosome<F>& mum, const BitStringChromosome<F>& dad)
+    {
+        // According to crossover probability it's the dad or mum that will begin to fill offspring genes
+        std::uniform_real_distribution<float> distribution(0.0, 1.0);
+        float probaCrossOver = distribution(generator);
+        this->m_isDirty = true;
+
+        const unsigned int nbGenes = this->m_nbGenes;
+        if (nbGenes == 0)
+        {
+            this->m_datas.clear();
+            return;
+        }
+
+        // Random number to define on which genes crossover begin
+        std::uniform_int_distribution<> distributionInt(0, nbGenes-1);
+        const unsigned int indexCrossover = distributionInt(generator);
+
+        const std::vector< uint64_t >& first = probaCrossOver <= 0.5 ? mum.m_datas : dad.m_datas;
+        const std::vector< uint64_t >& second = probaCrossOver <= 0.5 ? dad.m_datas : mum.m_datas;
+
+        // Words before the crossover point come from first, words after from second
+        const unsigned int nbWords = getNbWords();
+        const unsigned int crossoverWord = indexCrossover >> 6;
+        this->m_datas.resize(nbWords);
+        std::copy(first.begin(), first.begin() + crossoverWord, this->m_datas.begin());
+        std::copy(second.begin() + crossoverWord + 1, second.begin() + nbWords, this->m_datas.begin() + crossoverWord + 1);
+
+        // The word of the crossover point mixes both
+        const uint64_t firstMask = (uint64_t(1) << (indexCrossover & 63)) - 1;
+        this->m_datas[crossoverWord] = (first[crossoverWord] & firstMask) | (second[crossoverWord] & ~firstMask);
+    }
+
+    template<typename F>
+    unsigned int BitStringChromosome<F>::countOnes() const
+    {
+        unsigned int count = 0;
+        for (unsigned int w = 0 ; w < this->m_datas.size() ; ++w)
+            count += popCount(this->m_datas[w]);
+        return count;
+    }
+
+    template<typename F>
+    std::string BitStringChromosome<F>::datasToStr()
+    {
+        const unsigned int nbBits = std::min< unsigned int >(this->m_nbGenes, this->m_datas.size() * 64);
+        std::string datasStr(nbBits, '0');
+        for (unsigned int i = 0 ; i < nbBits ; i++)
+            if (getBit(i))
+                datasStr[i] = '1';
+        return datasStr;
+    }
+
+}
+
+#endif // BITSTRINGCHROMOSOME_H
@@ -0,0 +1,143 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <vector>
+#include <array>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace smoga
+{
+
+    /**
+     * @brief The CheckpointHeader struct Header written at the beginning of a checkpoint, the state of the algorithm follows.
+     * Values are written in the byte order of the machine.
+     */
+    struct CheckpointHeader
+    {
+        char magic[8];          ///> "SMGACKP" followed by '\0'.
+        uint32_t version;       ///> Version of the format.
+        uint32_t geneSize;      ///> Size of a gene in bytes.
+        uint32_t fitnessSize;   ///> Size of a fitness value in bytes.
+    };
+
+    /**
+     * @brief The CheckpointWriter class Write the state of an algorithm in a binary checkpoint.
+     * The state is written in a temporary file which replaces the checkpoint once complete (commit),
+     * so that a run killed while writing keeps its previous checkpoint.
+     */
+    class CheckpointWriter
+    {
+    protected:
+        std::string m_fileName;         ///> Name of the checkpoint.
+        std::string m_temporaryName;    ///> Name of the file written until commit.
+        std::ofstream m_file;           ///> Temporary file.
+
+    public:
+        /**
+         * @brief CheckpointWriter Create the temporary file of a checkpoint and write its header.
+         * @param fileName Name of the checkpoint, replaced by commit if it exists.
+         * @param geneSize Size of a gene in bytes.
+         * @param fitnessSize Size of a fitness value in bytes.
+         */
+        CheckpointWriter(const std::string& fileName, const uint32_t geneSize, const uint32_t fitnessSize);
+        CheckpointWriter(const CheckpointWriter& other) = delete;
+        virtual ~CheckpointWriter();
+
+        CheckpointWriter& operator=(const CheckpointWriter& other) = delete;
+
+        /**
+         * @brief write Append values to the checkpoint.
+         * @param datas Values to append.
+         * @param size Size of the values in bytes.
+         */
+        inline void write(const void* datas, const std::size_t size) { m_file.write(static_cast< const char* >(datas), size); }
+
+        template<typename T>
+        /**
+         * @brief writeValue Append a value to the checkpoint, T must be trivially copyable.
+         * @param value Value to append.
+         */
+        inline void writeValue(const T& value) { write(&value, sizeof(T)); }
+
+        /**
+         * @brief commit Close the temporary file and replace the checkpoint by it.
+         */
+        void commit();
+    };
+
+    /**
+     * @brief The CheckpointReader class Read the state of an algorithm in a binary checkpoint.
+     */
+    class CheckpointReader
+    {
+    protected:
+        std::ifstream m_file;       ///> File of the checkpoint.
+        CheckpointHeader m_header;  ///> Header of the checkpoint.
+
+    public:
+        /**
+         * @brief CheckpointReader Open a checkpoint and check its header.
+         * @param fileName Name of the checkpoint.
+         * @param geneSize Size of a gene in bytes expected by the algorithm.
+         * @param fitnessSize Size of a fitness value in bytes expected by the algorithm.
+         */
+        CheckpointReader(const std::string& fileName, const uint32_t geneSize, const uint32_t fitnessSize);
+        CheckpointReader(const CheckpointReader& other) = delete;
+        virtual ~CheckpointReader();
+
+        CheckpointReader& operator=(const CheckpointReader& other) = delete;
+
+        /**
+         * @brief read Read the next values of the checkpoint.
+         * @param datas Memory receiving the values.
+         * @param size Size of the values in bytes.
+         */
+        void read(void* datas, const std::size_t size);
+
+        template<typename T>
+        /**
+         * @brief readValue Read the next value of the checkpoint, T must be trivially copyable.
+         * @return The value.
+         */
+        inline T readValue()
+        {
+            T value;
+            read(&value, sizeof(T));
+            return value;
+        }
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getHeader Get the header of the checkpoint.
+         * @return The header.
+         */
+        inline const CheckpointHeader& getHeader() const { return m_header; }
+    };
+
+    template<typename T>
+    /**
+     * @brief resizeGenome Give a genome read in a checkpoint its number of genes.
+     * @param genome Genome of a chromosome with a dynamic number of genes.
+     * @param nbGenes Number of genes.
+     */
+    void resizeGenome(std::vector< T >& genome, const unsigned int nbGenes) { genome.resize(nbGenes); }
+
+    template<typename T, std::size_t N>
+    /**
+     * @brief resizeGenome Check the number of genes of a genome read in a checkpoint, which can't be changed.
+     * @param genome Genome of a chromosome with a fixed number of genes.
+     * @param nbGenes Number of genes.
+     */
+    void resizeGenome(std::array< T, N >& /*genome*/, const unsigned int nbGenes)
+    {
+        if (nbGenes != N)
+            throw std::runtime_error("Number of genes of the checkpoint doesn't match the chromosomes!");
+    }
+
+}
+
+#endif // CHECKPOINT_H
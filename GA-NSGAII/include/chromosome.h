@@ -2,7 +2,13 @@
 #define CHROMOSOME_H
 
 #include <vector>
+#include <string>
 #include <functional>
+#include <random>
+#include <utility>
+
+#include "random.h"
+#include "checkpoint.h"
 
 namespace smoga
 {
@@ -16,14 +22,21 @@ namespace smoga
     protected:
         std::vector < F > m_fitness;        ///> Fitness of the individual for the given problem
         std::vector< DATA > m_datas;        ///> Describe how the chromosome is represented to apply the GA
+        bool m_isDirty;                     ///> Indicate that the genes changed since the last evaluation of the fitness
         static unsigned int m_nbGenes;      ///> Number of genes
 
     public:
         Chromosome();
+        Chromosome(const Chromosome& other) = default;
+        Chromosome(Chromosome&& other) = default;
         virtual ~Chromosome();
 
+        Chromosome& operator=(const Chromosome& other) = default;
+        Chromosome& operator=(Chromosome&& other) = default;
+
         /**
          * @brief mutate Method call to apply mutation on the chromosome.
+         * @return true if the genes changed, populations then mark the chromosome dirty.
          */
         virtual bool mutate() =0;
 
@@ -37,12 +50,43 @@ namespace smoga
          */
         virtual void generateRandomChromosome() =0;
 
+        /**
+         * @brief crossOver Set the genes of the chromosome to a one point crossover of the genes of mum and dad,
+         * the genes of mum or dad being taken first with a probability of 1/2.
+         * Populations call it on their chromosome type C, so that a chromosome can provide its own crossover by hiding this one.
+         * @param mum First parent.
+         * @param dad Second parent.
+         */
+        void crossOver(const Chromosome& mum, const Chromosome& dad);
+
         ////////////// Accessor/Setters //////////////
         /**
          * @brief getFitness Fitness of the chromosome.
-         * @return The fitness.
+         * @return Constant reference on the fitness.
+         */
+        inline const std::vector < F >& getFitness() const { return m_fitness; }
+        /**
+         * @brief setFitness Set the fitness of the chromosome, computed for the same genes (ex : by a FitnessCache).
+         * @param fitness Fitness of the genes.
          */
-        inline std::vector < F > getFitness() const { return m_fitness; }
+        inline void setFitness(const std::vector < F >& fitness) { m_fitness = fitness; }
+        /**
+         * @brief setFitness Set the fitness of the chromosome, computed for the same genes (ex : by a batch evaluation).
+         * @param fitness Fitness values of the genes.
+         * @param nbObjectives Number of objectives.
+         */
+        inline void setFitness(const F* fitness, const unsigned int nbObjectives) { m_fitness.assign(fitness, fitness + nbObjectives); }
+
+        /**
+         * @brief isDirty Check if the genes changed since the last evaluation of the fitness.
+         * @return true if the fitness has to be computed.
+         */
+        inline bool isDirty() const { return m_isDirty; }
+        /**
+         * @brief setDirty Mark the fitness as outdated or up to date.
+         * @param isDirty true if the genes changed since the last evaluation of the fitness.
+         */
+        inline void setDirty(const bool isDirty) { m_isDirty = isDirty; }
 
         /**
          * @brief getNbObjective Get the number of objective.
@@ -52,14 +96,19 @@ namespace smoga
 
         /**
          * @brief getDatas Allow to get all genes of the chromosome.
-         * @return Genes's vector of the chromosome.
+         * @return Constant reference on the genes's vector of the chromosome.
          */
-        inline std::vector< DATA > getDatas() const { return m_datas; }
+        inline const std::vector< DATA >& getDatas() const { return m_datas; }
         /**
          * @brief setDatas Set all genes of the chromosome to the parameter value.
          * @param datas Genes's vector of the chromosome
          */
-        inline void setDatas(const std::vector< DATA > datas) { m_datas = datas; }
+        inline void setDatas(const std::vector< DATA >& datas) { m_datas = datas; m_isDirty = true; }
+        /**
+         * @brief setDatas Set all genes of the chromosome to the parameter value, without copying it.
+         * @param datas Genes's vector of the chromosome, moved into the chromosome.
+         */
+        inline void setDatas(std::vector< DATA >&& datas) { m_datas = std::move(datas); m_isDirty = true; }
 
         /**
          * @brief datasToStr Convert the vector of DATA into a string.
@@ -83,6 +132,17 @@ namespace smoga
          */
         static int getNbGenes() { return m_nbGenes; }
 
+        /**
+         * @brief writeCheckpointParameters Write the parameters of the chromosomes kept in static members beside m_nbGenes (nothing by default).
+         * @param checkpoint Checkpoint receiving the parameters.
+         */
+        static void writeCheckpointParameters(CheckpointWriter& /*checkpoint*/) {}
+        /**
+         * @brief readCheckpointParameters Restore the parameters written by writeCheckpointParameters.
+         * @param checkpoint Checkpoint to read.
+         */
+        static void readCheckpointParameters(CheckpointReader& /*checkpoint*/) {}
+
         // Operator
         bool operator<(const Chromosome<F, DATA>& chromosome) const { return m_fitness < chromosome.m_fitness; }
         bool operator ==(const Chromosome<F, DATA>& chromosome) const { return m_fitness == chromosome.m_fitness && m_datas == chromosome.m_datas; }
@@ -93,6 +153,9 @@ namespace smoga
 
     template<typename F, typename DATA>
     Chromosome<F, DATA>::Chromosome()
+        : m_fitness()
+        , m_datas()
+        , m_isDirty(true)
     {
     }
 
@@ -101,6 +164,32 @@ namespace smoga
     {
     }
 
+    template<typename F, typename DATA>
+    void Chromosome<F, DATA>::crossOver(const Chromosome<F, DATA>& mum, const Chromosome<F, DATA>& dad)
+    {
+        // According to crossover probability it's the dad or mum that will begin to fill offspring genes
+        std::uniform_real_distribution<float> distribution(0.0, 1.0);
+        float probaCrossOver = distribution(generator);
+        m_isDirty = true;
+
+        const unsigned int nbGenes = m_nbGenes;
+        if (nbGenes == 0)
+        {
+            m_datas.clear();
+            return;
+        }
+
+        // Random number to define on which genes crossover begin
+        std::uniform_int_distribution<> distributionInt(0, nbGenes-1);
+        const unsigned int indexCrossover = distributionInt(generator);
+
+        const Chromosome<F, DATA>& first = probaCrossOver <= 0.5 ? mum : dad;
+        const Chromosome<F, DATA>& second = probaCrossOver <= 0.5 ? dad : mum;
+
+        m_datas.assign(first.m_datas.begin(), first.m_datas.begin() + indexCrossover);
+        m_datas.insert(m_datas.end(), second.m_datas.begin() + indexCrossover, second.m_datas.begin() + nbGenes);
+    }
+
     template<typename F, typename DATA>
     std::string Chromosome<F, DATA>::datasToStr()
     {
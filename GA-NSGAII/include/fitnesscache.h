@@ -0,0 +1,234 @@
+#ifndef FITNESSCACHE_H
+#define FITNESSCACHE_H
+
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <functional>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <cstdint>
+
+namespace smoga
+{
+
+    template<typename C>
+    /**
+     * @brief The FitnessCache class Provide a bounded memory of the fitness of genomes already evaluated, to skip repeated evaluations.
+     * Genomes are spread in shards by their hash, each shard having its own mutex so that threads evaluating a population rarely wait,
+     * and forgetting its oldest genome when it is full. Genes are stored with the fitness, so hash collisions never give a wrong fitness.
+     * The fitness computed by C::computeFitness must only depend on the genes.
+     */
+    class FitnessCache
+    {
+    public:
+        typedef typename std::decay<decltype(std::declval<const C&>().getDatas())>::type Genes;     ///> Container of the genes of C.
+        typedef typename std::decay<decltype(std::declval<const C&>().getFitness())>::type Fitness; ///> Container of the fitness of C.
+
+    protected:
+        /**
+         * @brief The Entry struct Genome stored in a shard.
+         */
+        struct Entry
+        {
+            uint64_t hash;      ///> Hash of the genes.
+            Genes genes;        ///> Genes of the genome.
+            Fitness fitness;    ///> Fitness of the genome.
+            bool used;          ///> Indicate that the entry stores a genome.
+        };
+
+        /**
+         * @brief The Shard struct Part of the cache protected by its own mutex.
+         */
+        struct Shard
+        {
+            std::mutex mutex;                                   ///> Protect the shard.
+            std::unordered_map< uint64_t, unsigned int > slots; ///> Entry of each hash.
+            std::vector< Entry > entries;                       ///> Entries, replaced in a circular order.
+            unsigned int next;                                  ///> Next entry to replace.
+        };
+
+        std::vector< std::unique_ptr< Shard > > m_shards;   ///> Shards of the cache.
+        unsigned int m_capacity;                            ///> Number maximum of genomes in the cache.
+        std::atomic< uint64_t > m_nbHits;                   ///> Number of fitness found in the cache.
+        std::atomic< uint64_t > m_nbMisses;                 ///> Number of fitness not found in the cache.
+
+        /**
+         * @brief hash Compute the hash of genes.
+         * @param genes Genes to hash.
+         * @return Hash of the genes.
+         */
+        static uint64_t hash(const Genes& genes);
+
+        /**
+         * @brief shard Get the shard of a hash.
+         * @param hash Hash of genes.
+         * @return The shard.
+         */
+        inline Shard& shard(const uint64_t hash) const { return *m_shards[(hash >> 32) % m_shards.size()]; }
+
+    public:
+        /**
+         * @brief FitnessCache Create an empty cache.
+         * @param capacity Number maximum of genomes in the cache.
+         * @param nbShards Number of shards, each one having capacity/nbShards genomes.
+         */
+        FitnessCache(const unsigned int capacity = 65536, const unsigned int nbShards = 16);
+        FitnessCache(const FitnessCache& other) = delete;
+        virtual ~FitnessCache();
+
+        FitnessCache& operator=(const FitnessCache& other) = delete;
+
+        /**
+         * @brief find Search the genes of the chromosome in the cache and set its fitness to the one found.
+         * @param chromosome Chromosome to search.
+         * @return true if the fitness has been found.
+         */
+        bool find(C& chromosome);
+
+        /**
+         * @brief insert Store the genes and the fitness of an evaluated chromosome, replacing the oldest genome of its shard when it is full.
+         * @param chromosome Chromosome to store.
+         */
+        void insert(const C& chromosome);
+
+        /**
+         * @brief clear Forget all genomes and reset statistics.
+         */
+        void clear();
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getCapacity Get the number maximum of genomes in the cache.
+         * @return Capacity of the cache.
+         */
+        inline unsigned int getCapacity() const { return m_capacity; }
+        /**
+         * @brief getNbHits Get the number of fitness found in the cache.
+         * @return Number of hits.
+         */
+        inline uint64_t getNbHits() const { return m_nbHits; }
+        /**
+         * @brief getNbMisses Get the number of fitness not found in the cache.
+         * @return Number of misses.
+         */
+        inline uint64_t getNbMisses() const { return m_nbMisses; }
+    };
+
+    template<typename C>
+    FitnessCache<C>::FitnessCache(const unsigned int capacity, const unsigned int nbShards)
+        : m_shards()
+        , m_capacity(capacity)
+        , m_nbHits(0)
+        , m_nbMisses(0)
+    {
+        const unsigned int nbShardsUsed = std::max(1u, std::min(nbShards, capacity));
+        const unsigned int shardCapacity = std::max(1u, (capacity + nbShardsUsed - 1) / nbShardsUsed);
+        for (unsigned int s = 0 ; s < nbShardsUsed ; ++s)
+        {
+            m_shards.push_back(std::unique_ptr< Shard >(new Shard));
+            m_shards.back()->slots.reserve(shardCapacity);
+            m_shards.back()->entries.resize(shardCapacity);
+            m_shards.back()->next = 0;
+            for (unsigned int e = 0 ; e < shardCapacity ; ++e)
+                m_shards.back()->entries[e].used = false;
+        }
+    }
+
+    template<typename C>
+    FitnessCache<C>::~FitnessCache()
+    {
+    }
+
+    template<typename C>
+    uint64_t FitnessCache<C>::hash(const Genes& genes)
+    {
+        // Each gene is mixed with splitmix64's finalizer, so that close genomes have very different hashes
+        std::hash< typename Genes::value_type > hashGene;
+        uint64_t hash = 0x9E3779B97F4A7C15ULL ^ genes.size();
+        for (auto it = genes.begin() ; it != genes.end() ; ++it)
+        {
+            hash ^= hashGene(*it);
+            hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+            hash ^= hash >> 31;
+        }
+        return hash;
+    }
+
+    template<typename C>
+    bool FitnessCache<C>::find(C& chromosome)
+    {
+        const Genes& genes = chromosome.getDatas();
+        const uint64_t genesHash = hash(genes);
+        Shard& genesShard = shard(genesHash);
+
+        {
+            std::unique_lock<std::mutex> lock(genesShard.mutex);
+            auto slot = genesShard.slots.find(genesHash);
+            if (slot != genesShard.slots.end() && genesShard.entries[slot->second].genes == genes)
+            {
+                chromosome.setFitness(genesShard.entries[slot->second].fitness);
+                ++m_nbHits;
+                return true;
+            }
+        }
+
+        ++m_nbMisses;
+        return false;
+    }
+
+    template<typename C>
+    void FitnessCache<C>::insert(const C& chromosome)
+    {
+        const Genes& genes = chromosome.getDatas();
+        const uint64_t genesHash = hash(genes);
+        Shard& genesShard = shard(genesHash);
+
+        std::unique_lock<std::mutex> lock(genesShard.mutex);
+
+        // A genome with the same hash is replaced, otherwise the oldest genome
+        unsigned int index;
+        auto slot = genesShard.slots.find(genesHash);
+        if (slot != genesShard.slots.end())
+            index = slot->second;
+        else
+        {
+            index = genesShard.next;
+            genesShard.next = (genesShard.next + 1) % genesShard.entries.size();
+
+            Entry& oldest = genesShard.entries[index];
+            if (oldest.used)
+                genesShard.slots.erase(oldest.hash);
+            genesShard.slots[genesHash] = index;
+        }
+
+        // Assignments reuse the storage of the replaced genome
+        Entry& entry = genesShard.entries[index];
+        entry.hash = genesHash;
+        entry.genes = genes;
+        entry.fitness = chromosome.getFitness();
+        entry.used = true;
+    }
+
+    template<typename C>
+    void FitnessCache<C>::clear()
+    {
+        for (unsigned int s = 0 ; s < m_shards.size() ; ++s)
+        {
+            std::unique_lock<std::mutex> lock(m_shards[s]->mutex);
+            m_shards[s]->slots.clear();
+            m_shards[s]->next = 0;
+            for (unsigned int e = 0 ; e < m_shards[s]->entries.size() ; ++e)
+                m_shards[s]->entries[e].used = false;
+        }
+        m_nbHits = 0;
+        m_nbMisses = 0;
+    }
+
+}
+
+#endif // FITNESSCACHE_H
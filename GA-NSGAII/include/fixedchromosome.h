@@ -0,0 +1,171 @@
+#ifndef FIXEDCHROMOSOME_H
+#define FIXEDCHROMOSOME_H
+
+#include <array>
+#include <algorithm>
+#include <string>
+#include <random>
+#include <stdexcept>
+
+#include "random.h"
+#include "checkpoint.h"
+
+namespace smoga
+{
+
+    template<typename F, typename DATA, unsigned int NGenes, unsigned int NObjectives>
+    /**
+     * @brief The FixedChromosome class Provide a chromosome whose numbers of genes and objectives are known at compile time.
+     * Genes and fitness are stored in std::array and there is no virtual function, so a chromosome is trivially copyable
+     * when DATA and F are, doesn't allocate memory and a vector of chromosomes is a contiguous block.
+     * Populations use it as Chromosome : derived classes provide mutate, computeFitness and generateRandomChromosome
+     * (called on the type C, without virtual call), and can hide crossOver.
+     */
+    class FixedChromosome
+    {
+    protected:
+        std::array< F, NObjectives > m_fitness;     ///> Fitness of the individual for the given problem
+        std::array< DATA, NGenes > m_datas;         ///> Describe how the chromosome is represented to apply the GA
+        bool m_isDirty;                             ///> Indicate that the genes changed since the last evaluation of the fitness
+
+    public:
+        FixedChromosome();
+
+        /**
+         * @brief crossOver Set the genes of the chromosome to a one point crossover of the genes of mum and dad,
+         * the genes of mum or dad being taken first with a probability of 1/2.
+         * @param mum First parent.
+         * @param dad Second parent.
+         */
+        void crossOver(const FixedChromosome& mum, const FixedChromosome& dad);
+
+        ////////////// Accessor/Setters //////////////
+        /**
+         * @brief getFitness Fitness of the chromosome.
+         * @return The fitness.
+         */
+        inline const std::array< F, NObjectives >& getFitness() const { return m_fitness; }
+        /**
+         * @brief setFitness Set the fitness of the chromosome, computed for the same genes (ex : by a FitnessCache).
+         * @param fitness Fitness of the genes.
+         */
+        inline void setFitness(const std::array< F, NObjectives >& fitness) { m_fitness = fitness; }
+        /**
+         * @brief setFitness Set the fitness of the chromosome, computed for the same genes (ex : by a batch evaluation).
+         * @param fitness Fitness values of the genes.
+         * @param nbObjectives Number of objectives, must be NObjectives.
+         */
+        inline void setFitness(const F* fitness, const unsigned int nbObjectives)
+        {
+            if (nbObjectives != NObjectives)
+                throw std::runtime_error("Number of objectives of a fixed chromosome can't be changed!");
+            std::copy(fitness, fitness + NObjectives, m_fitness.begin());
+        }
+
+        /**
+         * @brief isDirty Check if the genes changed since the last evaluation of the fitness.
+         * @return true if the fitness has to be computed.
+         */
+        inline bool isDirty() const { return m_isDirty; }
+        /**
+         * @brief setDirty Mark the fitness as outdated or up to date.
+         * @param isDirty true if the genes changed since the last evaluation of the fitness.
+         */
+        inline void setDirty(const bool isDirty) { m_isDirty = isDirty; }
+
+        /**
+         * @brief getNbObjective Get the number of objective.
+         * @return Number of Objective.
+         */
+        inline unsigned int getNbObjective() const { return NObjectives; }
+
+        /**
+         * @brief getDatas Allow to get all genes of the chromosome.
+         * @return Genes's array of the chromosome.
+         */
+        inline const std::array< DATA, NGenes >& getDatas() const { return m_datas; }
+        /**
+         * @brief setDatas Set all genes of the chromosome to the parameter value.
+         * @param datas Genes's array of the chromosome
+         */
+        inline void setDatas(const std::array< DATA, NGenes >& datas) { m_datas = datas; m_isDirty = true; }
+
+        /**
+         * @brief datasToStr Convert the array of DATA into a string.
+         * @return String representing m_datas.
+         */
+        std::string datasToStr() const;
+
+        /**
+         * @brief setNbGenes Check the number of genes, which can't be changed at run time.
+         * @param nbGenes The number of genes wanted, must be NGenes.
+         */
+        static void setNbGenes(const int nbGenes)
+        {
+            if (nbGenes != (int)NGenes)
+                throw std::runtime_error("Number of genes of a fixed chromosome can't be changed!");
+        }
+        /**
+         * @brief getNbGenes Get the number of genes composing the chromosome.
+         * @return The number of genes.
+         */
+        static int getNbGenes() { return NGenes; }
+
+        /**
+         * @brief writeCheckpointParameters Write the parameters of the chromosomes kept in static members beside m_nbGenes (nothing by default).
+         * @param checkpoint Checkpoint receiving the parameters.
+         */
+        static void writeCheckpointParameters(CheckpointWriter& /*checkpoint*/) {}
+        /**
+         * @brief readCheckpointParameters Restore the parameters written by writeCheckpointParameters.
+         * @param checkpoint Checkpoint to read.
+         */
+        static void readCheckpointParameters(CheckpointReader& /*checkpoint*/) {}
+
+        // Operator
+        bool operator<(const FixedChromosome& chromosome) const { return m_fitness < chromosome.m_fitness; }
+        bool operator ==(const FixedChromosome& chromosome) const { return m_fitness == chromosome.m_fitness && m_datas == chromosome.m_datas; }
+    };
+
+    template<typename F, typename DATA, unsigned int NGenes, unsigned int NObjectives>
+    FixedChromosome<F, DATA, NGenes, NObjectives>::FixedChromosome()
+        : m_fitness()
+        , m_datas()
+        , m_isDirty(true)
+    {
+    }
+
+    template<typename F, typename DATA, unsigned int NGenes, unsigned int NObjectives>
+    void FixedChromosome<F, DATA, NGenes, NObjectives>::crossOver(const FixedChromosome& mum, const FixedChromosome& dad)
+    {
+        // According to crossover probability it's the dad or mum that will begin to fill offspring genes
+        std::uniform_real_distribution<float> distribution(0.0, 1.0);
+        float probaCrossOver = distribution(generator);
+        m_isDirty = true;
+
+        if (NGenes == 0)
+            return;
+
+        // Random number to define on which genes crossover begin
+        std::uniform_int_distribution<> distributionInt(0, NGenes-1);
+        const unsigned int indexCrossover = distributionInt(generator);
+
+        const FixedChromosome& first = probaCrossOver <= 0.5 ? mum : dad;
+        const FixedChromosome& second = probaCrossOver <= 0.5 ? dad : mum;
+
+        for (unsigned int i = 0 ; i < NGenes ; ++i)
+            m_datas[i] = i < indexCrossover ? first.m_datas[i] : second.m_datas[i];
+    }
+
+    template<typename F, typename DATA, unsigned int NGenes, unsigned int NObjectives>
+    std::string FixedChromosome<F, DATA, NGenes, NObjectives>::datasToStr() const
+    {
+        std::string datasStr = "";
+        for (unsigned int i = 0 ; i < NGenes ; i++)
+            datasStr += m_datas[i] + '0';
+        return datasStr;
+    }
+
+}
+
+#endif // FIXEDCHROMOSOME_H
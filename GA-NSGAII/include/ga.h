@@ -3,10 +3,17 @@
 
 #include <vector>
 #include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 #include "AlgoString.h"
 
 #include "population.h"
+#include "threadpool.h"
+#include "runlog.h"
+#include "asyncrunlogwriter.h"
+#include "checkpoint.h"
 
 namespace smoga
 {
@@ -17,6 +24,10 @@ namespace smoga
      */
     class GA
     {
+    public:
+        typedef typename std::decay<decltype(std::declval<const C&>().getDatas())>::type::value_type Gene;       ///> Type of the genes of C.
+        typedef typename std::decay<decltype(std::declval<const C&>().getFitness())>::type::value_type Fitness;  ///> Type of the fitness values of C.
+
     protected:
         bool m_isInitialized;       ///> Indicate if the GA has been initialized.
 
@@ -24,12 +35,103 @@ namespace smoga
         int m_currentGeneration;    ///> Index of the current generation running.
 
         P* m_population;            ///> Current population of solutions.
+        P* m_nextPopulation;        ///> Buffer receiving the next generation, swapped with m_population so that chromosomes storage is reused.
+
+        ThreadPool* m_threadPool;   ///> Pool created once and shared by all parallel steps of the algorithm (nullptr when the algorithm is serial).
+        FitnessCache< C >* m_fitnessCache;  ///> Cache of the fitness of genomes already evaluated, shared by all populations (nullptr without cache).
+
+        uint64_t m_randomStage;     ///> Index of the next stage of the run drawing random numbers.
+
+        std::string m_runLogFileName;   ///> Name of the run log file, empty without run log.
+        RunLogWriter* m_runLog;         ///> Run log receiving each generation, created by the first logged generation (nullptr before).
+        unsigned int m_runLogQueueCapacity;         ///> Number maximum of records waiting for the writer thread of the run log (0 for a synchronous run log).
+        AsyncRunLogWriter::Policy m_runLogPolicy;   ///> Behaviour of the asynchronous run log when its queue is full.
+        unsigned int m_runLogSamplingInterval;      ///> Interval between 2 logged generations with AsyncRunLogWriter::SAMPLE.
+
+        std::string m_checkpointFileName;   ///> Name of the checkpoint written during the run, empty without checkpoint.
+        unsigned int m_checkpointInterval;  ///> Number of generations between 2 checkpoints.
+
+        /**
+         * @brief nextRandomStage Get a new stage of the run, each work item of the stage draws on its own random stream (see selectRandomStream).
+         * @return Index of the stage.
+         */
+        inline uint64_t nextRandomStage() { return m_randomStage++; }
+
+        /**
+         * @brief createPopulation Create an empty population using the thread pool and the fitness cache of the algorithm.
+         * @return The new population, owned by the caller.
+         */
+        P* createPopulation() const;
+
+        /**
+         * @brief updatePopulations Give the thread pool and the fitness cache of the algorithm to all its populations, after a change of one of them.
+         */
+        virtual void updatePopulations();
+
+        /**
+         * @brief prepareNextPopulation Empty m_nextPopulation, created on first call, keeping its chromosomes as spare.
+         * The next generation is written in it before being swapped with m_population.
+         * @return m_nextPopulation.
+         */
+        P* prepareNextPopulation();
 
         /**
          * @brief releaseMemory Free all the memory used by the algorithm that haven't been deallocate during the processing.
          */
         virtual void releaseMemory();
 
+        /**
+         * @brief logGeneration Write the current population in the run log, called at the end of each generation when a run log is open.
+         */
+        virtual void logGeneration();
+        /**
+         * @brief beginLogRecord Begin the record of the current population in the run log, creating the run log on first call,
+         * and write the genes and fitness columns. Chromosomes are read in place, without copy.
+         * @param withRanks true if the ranks and crowding distances columns follow (written by the caller).
+         * @return The run log, nullptr if the generation isn't logged (sampled out or dropped by an asynchronous run log).
+         */
+        RunLogWriter* beginLogRecord(const bool withRanks);
+
+        /**
+         * @brief checkpointGeneration Write the checkpoint if the generation just run is a multiple of the checkpoint interval,
+         * called at the end of each generation.
+         */
+        void checkpointGeneration();
+        /**
+         * @brief writeCheckpoint Write the state of the algorithm : parameters, counters, random stream and population.
+         * @param checkpoint Checkpoint receiving the state.
+         */
+        virtual void writeCheckpoint(CheckpointWriter& checkpoint) const;
+        /**
+         * @brief readCheckpoint Restore the state of the algorithm written by writeCheckpoint.
+         * @param checkpoint Checkpoint to read.
+         */
+        virtual void readCheckpoint(CheckpointReader& checkpoint);
+        /**
+         * @brief writePopulation Write a population in a checkpoint : genes and fitness of each chromosome, in order.
+         * @param checkpoint Checkpoint receiving the population.
+         * @param population Population to write.
+         */
+        void writePopulation(CheckpointWriter& checkpoint, const P& population) const;
+        /**
+         * @brief readPopulation Create a population written by writePopulation, ready for selection.
+         * @param checkpoint Checkpoint to read.
+         * @return The population, owned by the caller.
+         */
+        P* readPopulation(CheckpointReader& checkpoint) const;
+        /**
+         * @brief writeChromosomeStates Write the state of the chromosomes of a population kept beside their genes and fitness (nothing by default).
+         * @param checkpoint Checkpoint receiving the states.
+         * @param population Population to write.
+         */
+        virtual void writeChromosomeStates(CheckpointWriter& /*checkpoint*/, const P& /*population*/) const {}
+        /**
+         * @brief readChromosomeStates Restore the state of the chromosomes written by writeChromosomeStates.
+         * @param checkpoint Checkpoint to read.
+         * @param population Population whose chromosomes have been read.
+         */
+        virtual void readChromosomeStates(CheckpointReader& /*checkpoint*/, P& /*population*/) const {}
+
     public:
         GA();
         virtual ~GA();
@@ -77,6 +179,53 @@ namespace smoga
          */
         virtual void dumpToFile(const std::string& fileName) { dumpToFile(fileName.c_str()); }
 
+        /**
+         * @brief openRunLog Log each next generation in a binary run log (see RunLogWriter), instead of a text file per generation.
+         * The file is created by the first generation logged, replacing the previous run log of the algorithm.
+         * @param fileName Name of the run log file.
+         */
+        void openRunLog(const std::string& fileName);
+        /**
+         * @brief closeRunLog Write the generations still buffered and stop logging.
+         */
+        void closeRunLog();
+        /**
+         * @brief setAsyncRunLog Write the next run logs on a background thread (see AsyncRunLogWriter), so that generations don't wait for the disk.
+         * @param queueCapacity Number maximum of generations waiting to be written, 0 for a synchronous run log.
+         * @param policy Behaviour when a generation is logged while the queue is full.
+         * @param samplingInterval Interval between 2 logged generations with AsyncRunLogWriter::SAMPLE.
+         */
+        void setAsyncRunLog(const unsigned int queueCapacity, const AsyncRunLogWriter::Policy policy = AsyncRunLogWriter::BLOCK, const unsigned int samplingInterval = 1);
+        /**
+         * @brief flushRunLog Write the generations still buffered, so that the run log can be read during the run.
+         */
+        inline void flushRunLog() { if (m_runLog) m_runLog->flush(); }
+        /**
+         * @brief getRunLog Get the run log receiving the generations.
+         * @return The run log, nullptr if no generation has been logged.
+         */
+        inline const RunLogWriter* getRunLog() const { return m_runLog; }
+
+        /**
+         * @brief saveCheckpoint Write the state of the algorithm in a binary checkpoint, so that the run can be resumed from it.
+         * @param fileName Name of the checkpoint, replaced once the new one is complete.
+         */
+        void saveCheckpoint(const std::string& fileName) const;
+        /**
+         * @brief resumeFromCheckpoint Restore the state of the algorithm written by saveCheckpoint, instead of initialize.
+         * Parameters of the population (P::readCheckpointParameters) and of the chromosomes (C::readCheckpointParameters)
+         * are restored with the state, so that the next generations are identical to the ones of the run which wrote the checkpoint.
+         * The run log isn't reopened.
+         * @param fileName Name of the checkpoint.
+         */
+        void resumeFromCheckpoint(const std::string& fileName);
+        /**
+         * @brief setCheckpoint Write a checkpoint every interval generations during the run.
+         * @param fileName Name of the checkpoint, empty to disable checkpoints.
+         * @param interval Number of generations between 2 checkpoints.
+         */
+        void setCheckpoint(const std::string& fileName, const unsigned int interval = 1);
+
 
         ////////////// Accessors/Setters //////////////
         /**
@@ -108,6 +257,29 @@ namespace smoga
          * @return m_population content.
          */
         inline const P& getPopulation() const {return *m_population;}
+
+        /**
+         * @brief setNbThreads Set the number of threads used by the algorithm, threads are created once and reused by each generation.
+         * @param nbThreads Number of threads, 1 for a serial algorithm and 0 for the number of cores.
+         */
+        virtual void setNbThreads(const unsigned int nbThreads);
+        /**
+         * @brief getNbThreads Get the number of threads used by the algorithm.
+         * @return Number of threads.
+         */
+        inline unsigned int getNbThreads() const { return m_threadPool ? m_threadPool->getNbThreads() : 1; }
+
+        /**
+         * @brief setFitnessCacheCapacity Set the number of genomes whose fitness is kept to skip their evaluation when they are met again.
+         * The fitness computed by C::computeFitness must only depend on the genes.
+         * @param capacity Number maximum of genomes in the cache, 0 to disable the cache.
+         */
+        void setFitnessCacheCapacity(const unsigned int capacity);
+        /**
+         * @brief getFitnessCache Get the cache of the fitness of genomes already evaluated (ex : for its statistics).
+         * @return The cache, nullptr without cache.
+         */
+        inline const FitnessCache< C >* getFitnessCache() const { return m_fitnessCache; }
     };
 
     template<typename F, typename P, typename C>
@@ -115,6 +287,17 @@ namespace smoga
         : m_isInitialized(false)
         , m_nbGenerationsWanted(100)
         , m_population(nullptr)
+        , m_nextPopulation(nullptr)
+        , m_threadPool(nullptr)
+        , m_fitnessCache(nullptr)
+        , m_randomStage(0)
+        , m_runLogFileName()
+        , m_runLog(nullptr)
+        , m_runLogQueueCapacity(0)
+        , m_runLogPolicy(AsyncRunLogWriter::BLOCK)
+        , m_runLogSamplingInterval(1)
+        , m_checkpointFileName()
+        , m_checkpointInterval(1)
     {
     }
 
@@ -122,6 +305,60 @@ namespace smoga
     GA<F, P, C>::~GA()
     {
         releaseMemory();
+        delete m_threadPool;
+        delete m_fitnessCache;
+        delete m_runLog;
+    }
+
+    template<typename F, typename P, typename C>
+    P* GA<F, P, C>::createPopulation() const
+    {
+        P* population = new P;
+        population->setThreadPool(m_threadPool);
+        population->setFitnessCache(m_fitnessCache);
+        return population;
+    }
+
+    template<typename F, typename P, typename C>
+    P* GA<F, P, C>::prepareNextPopulation()
+    {
+        if (!m_nextPopulation)
+            m_nextPopulation = createPopulation();
+
+        m_nextPopulation->recycle();
+        m_nextPopulation->setNbMaxChromosomes(P::getSNbMaxChromosomes());
+        return m_nextPopulation;
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::setNbThreads(const unsigned int nbThreads)
+    {
+        delete m_threadPool;
+        m_threadPool = nbThreads == 1 ? nullptr : new ThreadPool(nbThreads);
+        updatePopulations();
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::setFitnessCacheCapacity(const unsigned int capacity)
+    {
+        delete m_fitnessCache;
+        m_fitnessCache = capacity == 0 ? nullptr : new FitnessCache< C >(capacity);
+        updatePopulations();
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::updatePopulations()
+    {
+        if (m_population)
+        {
+            m_population->setThreadPool(m_threadPool);
+            m_population->setFitnessCache(m_fitnessCache);
+        }
+        if (m_nextPopulation)
+        {
+            m_nextPopulation->setThreadPool(m_threadPool);
+            m_nextPopulation->setFitnessCache(m_fitnessCache);
+        }
     }
 
     template<typename F, typename P, typename C>
@@ -130,6 +367,203 @@ namespace smoga
         if (m_population)
             delete m_population;
         m_population = nullptr;
+        delete m_nextPopulation;
+        m_nextPopulation = nullptr;
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::openRunLog(const std::string& fileName)
+    {
+        closeRunLog();
+        m_runLogFileName = fileName;
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::closeRunLog()
+    {
+        delete m_runLog;
+        m_runLog = nullptr;
+        m_runLogFileName.clear();
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::setAsyncRunLog(const unsigned int queueCapacity, const AsyncRunLogWriter::Policy policy, const unsigned int samplingInterval)
+    {
+        m_runLogQueueCapacity = queueCapacity;
+        m_runLogPolicy = policy;
+        m_runLogSamplingInterval = samplingInterval;
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::logGeneration()
+    {
+        RunLogWriter* log = beginLogRecord(false);
+        if (log)
+            log->endGeneration();
+    }
+
+    template<typename F, typename P, typename C>
+    RunLogWriter* GA<F, P, C>::beginLogRecord(const bool withRanks)
+    {
+        const std::vector< C >& chromosomes = m_population->getChromosomes();
+        const unsigned int nbChromosomes = m_population->getCurrentNbChromosomes();
+
+        // Sizes of the columns are taken from the first logged population
+        if (!m_runLog)
+        {
+            const unsigned int nbGenes = nbChromosomes == 0 ? 0 : chromosomes[0].getDatas().size();
+            const unsigned int nbObjectives = nbChromosomes == 0 ? 0 : chromosomes[0].getFitness().size();
+            const RunLogHeader header = makeRunLogHeader< Gene, Fitness >(nbGenes, nbObjectives, withRanks);
+            if (m_runLogQueueCapacity == 0)
+                m_runLog = new RunLogWriter(m_runLogFileName, header);
+            else
+                m_runLog = new AsyncRunLogWriter(m_runLogFileName, header, m_runLogQueueCapacity, m_runLogPolicy, m_runLogSamplingInterval);
+        }
+
+        const RunLogHeader& header = m_runLog->getHeader();
+        if (!m_runLog->beginGeneration(m_currentGeneration, nbChromosomes))
+            return nullptr;
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+        {
+            if (chromosomes[i].getDatas().size() != header.nbGenes)
+                throw std::runtime_error("All logged chromosomes must have the same number of genes!");
+            m_runLog->write(chromosomes[i].getDatas().data(), header.nbGenes * sizeof(Gene));
+        }
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+        {
+            if (chromosomes[i].getFitness().size() != header.nbObjectives)
+                throw std::runtime_error("All logged chromosomes must have the same number of objectives!");
+            m_runLog->write(chromosomes[i].getFitness().data(), header.nbObjectives * sizeof(Fitness));
+        }
+
+        return m_runLog;
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::setCheckpoint(const std::string& fileName, const unsigned int interval)
+    {
+        m_checkpointFileName = fileName;
+        m_checkpointInterval = std::max(1u, interval);
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::checkpointGeneration()
+    {
+        // m_currentGeneration is the index of the next generation
+        if (!m_checkpointFileName.empty() && (m_currentGeneration - 1) % m_checkpointInterval == 0)
+            saveCheckpoint(m_checkpointFileName);
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::saveCheckpoint(const std::string& fileName) const
+    {
+        if (!m_isInitialized)
+            throw std::runtime_error("Impossible to write a checkpoint of an algorithm not initialized!");
+
+        CheckpointWriter checkpoint(fileName, sizeof(Gene), sizeof(Fitness));
+        writeCheckpoint(checkpoint);
+        checkpoint.commit();
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::resumeFromCheckpoint(const std::string& fileName)
+    {
+        CheckpointReader checkpoint(fileName, sizeof(Gene), sizeof(Fitness));
+        m_isInitialized = false;
+        releaseMemory();
+        readCheckpoint(checkpoint);
+        m_isInitialized = true;
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::writeCheckpoint(CheckpointWriter& checkpoint) const
+    {
+        // Parameters
+        checkpoint.writeValue< int32_t >(m_nbGenerationsWanted);
+        checkpoint.writeValue< uint32_t >(P::getSNbMaxChromosomes());
+        checkpoint.writeValue< double >(P::getCrossOverProbability());
+        checkpoint.writeValue< double >(P::getMutateProbability());
+        checkpoint.writeValue< double >(P::getProportionalKeeping());
+        P::writeCheckpointParameters(checkpoint);
+        checkpoint.writeValue< int32_t >(C::getNbGenes());
+        C::writeCheckpointParameters(checkpoint);
+
+        // Counters, the random streams of the next stages only depend on the seed and the stage
+        checkpoint.writeValue< int32_t >(m_currentGeneration);
+        checkpoint.writeValue< uint64_t >(m_randomStage);
+        checkpoint.writeValue< uint64_t >(getRandomSeed());
+
+        writePopulation(checkpoint, *m_population);
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::readCheckpoint(CheckpointReader& checkpoint)
+    {
+        m_nbGenerationsWanted = checkpoint.readValue< int32_t >();
+        P::setSNbMaxChromosomes(checkpoint.readValue< uint32_t >());
+        P::setCrossOverProbability(checkpoint.readValue< double >());
+        P::setMutateProbability(checkpoint.readValue< double >());
+        P::setProportionalKeeping(checkpoint.readValue< double >());
+        P::readCheckpointParameters(checkpoint);
+        C::setNbGenes(checkpoint.readValue< int32_t >());
+        C::readCheckpointParameters(checkpoint);
+
+        m_currentGeneration = checkpoint.readValue< int32_t >();
+        m_randomStage = checkpoint.readValue< uint64_t >();
+        setRandomSeed(checkpoint.readValue< uint64_t >());
+
+        m_population = readPopulation(checkpoint);
+    }
+
+    template<typename F, typename P, typename C>
+    void GA<F, P, C>::writePopulation(CheckpointWriter& checkpoint, const P& population) const
+    {
+        const std::vector< C >& chromosomes = population.getChromosomes();
+        const unsigned int nbChromosomes = population.getCurrentNbChromosomes();
+        checkpoint.writeValue< int32_t >(population.getNbMaxChromosomes());
+        checkpoint.writeValue< uint32_t >(nbChromosomes);
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+        {
+            const uint32_t nbGenes = chromosomes[i].getDatas().size();
+            const uint32_t nbObjectives = chromosomes[i].getFitness().size();
+            checkpoint.writeValue(nbGenes);
+            checkpoint.write(chromosomes[i].getDatas().data(), nbGenes * sizeof(Gene));
+            checkpoint.writeValue(nbObjectives);
+            checkpoint.write(chromosomes[i].getFitness().data(), nbObjectives * sizeof(Fitness));
+        }
+        writeChromosomeStates(checkpoint, population);
+    }
+
+    template<typename F, typename P, typename C>
+    P* GA<F, P, C>::readPopulation(CheckpointReader& checkpoint) const
+    {
+        typedef typename std::decay<decltype(std::declval<const C&>().getDatas())>::type Genome;
+
+        P* population = createPopulation();
+        population->setNbMaxChromosomes(checkpoint.readValue< int32_t >());
+        const unsigned int nbChromosomes = checkpoint.readValue< uint32_t >();
+        std::vector< Fitness > fitness;
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+        {
+            C chromosome;
+            Genome genes = chromosome.getDatas();
+            const uint32_t nbGenes = checkpoint.readValue< uint32_t >();
+            resizeGenome(genes, nbGenes);
+            checkpoint.read(genes.data(), nbGenes * sizeof(Gene));
+            chromosome.setDatas(std::move(genes));
+
+            // Fitness were computed for these genes, chromosomes aren't evaluated again
+            fitness.resize(checkpoint.readValue< uint32_t >());
+            checkpoint.read(fitness.data(), fitness.size() * sizeof(Fitness));
+            chromosome.setFitness(fitness.data(), fitness.size());
+            chromosome.setDirty(false);
+
+            population->addChromosome(std::move(chromosome));
+        }
+        readChromosomeStates(checkpoint, *population);
+
+        population->restoreSelection();
+        return population;
     }
 
     template<typename F, typename P, typename C>
@@ -179,6 +613,12 @@ namespace smoga
                     C::setNbGenes(getNumber<int>(lineSplited[1]));
                 else if (lineLabel == "proportionalkeeping")
                     P::setProportionalKeeping(getNumber<double>(lineSplited[1]));
+                else if (lineLabel == "numberthreads")
+                    setNbThreads(getNumber<int>(lineSplited[1]));
+                else if (lineLabel == "fitnesscachecapacity")
+                    setFitnessCacheCapacity(getNumber<unsigned int>(lineSplited[1]));
+                else if (lineLabel == "randomseed")
+                    setRandomSeed(getNumber<uint64_t>(lineSplited[1]));
                 else
                     throw std::runtime_error("There is an error in file.");
             }
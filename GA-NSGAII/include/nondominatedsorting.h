@@ -0,0 +1,1085 @@
+#ifndef NONDOMINATEDSORTING_H
+#define NONDOMINATEDSORTING_H
+
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+#include "General.h"
+#include "threadpool.h"
+#include "arena.h"
+
+namespace smoga
+{
+
+    typedef std::vector< unsigned int > Front;  ///> Indexes of the chromosomes composing a non-dominated front.
+
+    template<typename F, typename P, typename C>
+    /**
+     * @brief The NonDominatedSorter class Provide the interface of engines determining the non-dominated fronts of a population.
+     * Engines working on fitness values consider that all objectives are minimized (like ChromosomeMDoubleInt::dominates).
+     */
+    class NonDominatedSorter
+    {
+    protected:
+        unsigned int m_nbSolutions;     ///> Number of solutions to sort.
+        unsigned int m_nbObjectives;    ///> Number of objectives of each solution.
+        std::vector< F > m_fitness;     ///> Fitness of all solutions to sort (solution i in [i*m_nbObjectives, (i+1)*m_nbObjectives[).
+        ThreadPool* m_threadPool;       ///> Pool used by engines supporting a parallel sort (nullptr for a serial sort).
+        Arena m_arena;                  ///> Memory of the temporary datas of an engine, reset at the beginning of each sort.
+
+        /**
+         * @brief loadFitness Copy fitness of all chromosomes of popToSort in m_fitness.
+         * @param popToSort Population to sort.
+         */
+        void loadFitness(const P* popToSort);
+
+        /**
+         * @brief fitness Get the fitness values of a solution.
+         * @param index Index of the solution.
+         * @return Pointer on the first objective of the solution.
+         */
+        inline const F* fitness(const unsigned int index) const { return &m_fitness[index*m_nbObjectives]; }
+
+        /**
+         * @brief dominates Check if a solution dominates another one, using m_fitness.
+         * @param index1 Index of the first solution.
+         * @param index2 Index of the second solution.
+         * @return true if index1 is no worse than index2 in all objectives and strictly better in at least one.
+         */
+        bool dominates(const unsigned int index1, const unsigned int index2) const;
+
+        /**
+         * @brief lexicographicOrder Compute indexes of solutions sorted in lexicographic order of their fitness.
+         * @param order Vector filled with the sorted indexes.
+         */
+        void lexicographicOrder(std::vector< unsigned int >& order) const;
+
+        /**
+         * @brief sortTwoObjectives Determine fronts of a 2 objectives problem in O(N log N) by sweeping solutions in lexicographic order.
+         * @param order Indexes of solutions sorted in lexicographic order.
+         * @return Vector of non-dominated fronts.
+         */
+        std::vector< Front > sortTwoObjectives(const std::vector< unsigned int >& order) const;
+
+        /**
+         * @brief writeRanks Set the rank of all chromosomes of popToSort according to their front.
+         * @param popToSort Sorted population.
+         * @param fronts Fronts of popToSort.
+         */
+        static void writeRanks(P* popToSort, const std::vector< Front >& fronts);
+
+        /**
+         * @brief computeFronts Determine all non-dominated fronts of the solutions loaded in m_fitness.
+         * @return Vector of non-dominated fronts, first element correspond to front 1 and so on.
+         */
+        virtual std::vector< Front > computeFronts() =0;
+
+    public:
+        NonDominatedSorter();
+        virtual ~NonDominatedSorter();
+
+        /**
+         * @brief sort Determine all non-dominated front of the Population in parameter and set ranks of its chromosomes.
+         * @param popToSort Population to search non-dominated fronts.
+         * @return Vector of non-dominated fronts, first element correspond to front 1 and so on.
+         */
+        virtual std::vector< Front > sort(P* popToSort);
+
+        /**
+         * @brief sortFitnessMatrix Determine all non-dominated fronts of solutions stored in a fitness matrix, without population.
+         * @param fitness Fitness of all solutions (solution i in [i*nbObjectives, (i+1)*nbObjectives[), all objectives are minimized.
+         * @param nbSolutions Number of solutions.
+         * @param nbObjectives Number of objectives of each solution.
+         * @return Vector of non-dominated fronts of solution indexes, first element correspond to front 1 and so on.
+         */
+        std::vector< Front > sortFitnessMatrix(const F* fitness, const unsigned int nbSolutions, const unsigned int nbObjectives);
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief setThreadPool Set the pool used by engines supporting a parallel sort, results are identical to the serial sort.
+         * @param threadPool Pool to use (not owned), nullptr for a serial sort.
+         */
+        inline void setThreadPool(ThreadPool* threadPool) { m_threadPool = threadPool; }
+        /**
+         * @brief getThreadPool Get the pool used by engines supporting a parallel sort.
+         * @return The pool, nullptr for a serial sort.
+         */
+        inline ThreadPool* getThreadPool() const { return m_threadPool; }
+    };
+
+    template<typename F, typename P, typename C>
+    /**
+     * @brief The FastNonDominatedSorter class Deb's fast non-dominated sort in O(MN²), using C::dominates (minimized objectives for a fitness matrix).
+     * With a thread pool, rows of the domination relation are split in blocks, each row comparing its solution with all others.
+     */
+    class FastNonDominatedSorter
+            : public NonDominatedSorter<F, P, C>
+    {
+    protected:
+        std::vector< std::vector< unsigned int > > m_dominatedSolutions;   ///> Sp of each solution, kept between sorts so that their memory is reused.
+
+        /**
+         * @brief sortWith Run Deb's sort on solutions [0, nbSolutions[ with a dominance relation.
+         * @param nbSolutions Number of solutions.
+         * @param dominates Function telling if the solution p dominates the solution q, called concurrently with a thread pool.
+         * @return Vector of non-dominated fronts.
+         */
+        template<typename Dominates>
+        std::vector< Front > sortWith(const unsigned int nbSolutions, const Dominates& dominates);
+
+        /**
+         * @brief computeFronts Run Deb's sort on m_fitness, with minimized objectives.
+         */
+        virtual std::vector< Front > computeFronts();
+
+    public:
+        virtual std::vector< Front > sort(P* popToSort);
+    };
+
+    template<typename F, typename P, typename C>
+    /**
+     * @brief The EfficientNonDominatedSorter class Efficient Non-dominated Sort (ENS) of Zhang et al.
+     * Solutions are processed in lexicographic order, so that a solution can only be dominated by those already assigned,
+     * and the front of each solution is searched either sequentially (ENS-SS) or by a binary search (ENS-BS).
+     */
+    class EfficientNonDominatedSorter
+            : public NonDominatedSorter<F, P, C>
+    {
+    public:
+        /**
+         * @brief The SearchStrategy enum Strategy used to find the front of a solution.
+         */
+        enum SearchStrategy
+        {
+            SEQUENTIAL_SEARCH,  ///> ENS-SS
+            BINARY_SEARCH       ///> ENS-BS
+        };
+
+    protected:
+        SearchStrategy m_strategy;  ///> Strategy used to find the front of a solution.
+
+        /**
+         * @brief isDominatedByFront Check if a solution is dominated by one of the solutions of a front.
+         * @param front Front to check.
+         * @param index Index of the solution.
+         * @return true if a solution of the front dominates the solution index.
+         */
+        bool isDominatedByFront(const Front& front, const unsigned int index) const;
+
+        virtual std::vector< Front > computeFronts();
+
+    public:
+        EfficientNonDominatedSorter(const SearchStrategy strategy = BINARY_SEARCH);
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief setStrategy Set the strategy used to find the front of a solution.
+         * @param strategy Strategy wanted.
+         */
+        inline void setStrategy(const SearchStrategy strategy) { m_strategy = strategy; }
+        /**
+         * @brief getStrategy Get the strategy used to find the front of a solution.
+         * @return Strategy used.
+         */
+        inline SearchStrategy getStrategy() const { return m_strategy; }
+    };
+
+    template<typename F, typename P, typename C>
+    /**
+     * @brief The JensenFortinSorter class Divide and conquer non-dominated sort in O(N log^(M-1) N) of Jensen, with the handling of equal values from Fortin et al.
+     * Duplicated solutions are merged, then each objective value is replaced by its position in the order (value, lexicographic position),
+     * so that the recursion only handles distinct values.
+     */
+    class JensenFortinSorter
+            : public NonDominatedSorter<F, P, C>
+    {
+    protected:
+        std::vector< unsigned int > m_keys;     ///> Position of each unique solution for each objective (solution i in [i*m_nbObjectives, (i+1)*m_nbObjectives[).
+        std::vector< unsigned int > m_ranks;    ///> Rank of each unique solution.
+
+        /**
+         * @brief key Get the position of a unique solution for an objective.
+         * @param index Index of the unique solution.
+         * @param objective Objective wanted.
+         * @return The position.
+         */
+        inline unsigned int key(const unsigned int index, const unsigned int objective) const { return m_keys[index*this->m_nbObjectives + objective]; }
+
+        /**
+         * @brief helperA Assign ranks of solutions in S considering objectives 0 to k (objectives after k are equals in S).
+         * @param S Solutions sorted on the first objective.
+         * @param k Last objective considered.
+         */
+        void helperA(const std::vector< unsigned int >& S, const unsigned int k);
+
+        /**
+         * @brief helperB Update ranks of solutions in H according to those of L, considering objectives 0 to k (solutions of L are better than those of H on objectives after k).
+         * @param L Solutions sorted on the first objective, with final ranks.
+         * @param H Solutions sorted on the first objective.
+         * @param k Last objective considered.
+         */
+        void helperB(const std::vector< unsigned int >& L, const std::vector< unsigned int >& H, const unsigned int k);
+
+        /**
+         * @brief sweepA Assign ranks of solutions in S considering the 2 first objectives.
+         * @param S Solutions sorted on the first objective.
+         */
+        void sweepA(const std::vector< unsigned int >& S);
+
+        /**
+         * @brief sweepB Update ranks of solutions in H according to those of L, considering the 2 first objectives.
+         * @param L Solutions sorted on the first objective, with final ranks.
+         * @param H Solutions sorted on the first objective.
+         */
+        void sweepB(const std::vector< unsigned int >& L, const std::vector< unsigned int >& H);
+
+        /**
+         * @brief insertInStair Insert a solution in a stair (second objective => rank), keeping ranks strictly increasing with the second objective.
+         * @param stair Stair to update.
+         * @param index Solution to insert.
+         */
+        void insertInStair(std::map< unsigned int, unsigned int >& stair, const unsigned int index) const;
+
+        /**
+         * @brief rankFromStair Compute the minimal rank of a solution according to solutions of a stair.
+         * @param stair Stair of solutions.
+         * @param index Solution to check.
+         * @return Minimal rank of the solution.
+         */
+        unsigned int rankFromStair(const std::map< unsigned int, unsigned int >& stair, const unsigned int index) const;
+
+        /**
+         * @brief medianKey Compute the median position on objective k of solutions in parameter.
+         * @param first First set of solutions.
+         * @param second Second set of solutions.
+         * @param k Objective.
+         * @return Median position.
+         */
+        unsigned int medianKey(const std::vector< unsigned int >& first, const std::vector< unsigned int >& second, const unsigned int k) const;
+
+        virtual std::vector< Front > computeFronts();
+    };
+
+    template<typename F>
+    /**
+     * @brief compareWithBlock Compare a value with a block of 64 values.
+     * @param block First of the 64 values.
+     * @param value Value to compare.
+     * @param lowerOrEqual Bit b is set if block[b] <= value.
+     * @param lower Bit b is set if block[b] < value.
+     */
+    inline void compareWithBlock(const F* block, const F value, uint64_t& lowerOrEqual, uint64_t& lower);
+    inline void compareWithBlock(const double* block, const double value, uint64_t& lowerOrEqual, uint64_t& lower);
+    inline void compareWithBlock(const float* block, const float value, uint64_t& lowerOrEqual, uint64_t& lower);
+
+    template<typename F, typename P, typename C>
+    /**
+     * @brief The BitsetNonDominatedSorter class Non-dominated sort based on a bit-packed domination matrix.
+     * Solutions are placed in lexicographic order, so that a solution can only be dominated by those before it, and fitness values
+     * are stored objective by objective, so that comparisons of one solution with all the previous ones are contiguous and done with SIMD.
+     * Per-objective comparison bits are packed in 64 bits words and ANDed to get the set of solutions dominating each solution,
+     * then fronts are derived from popcounts of these sets. The triangular matrix needs N²/16 bytes, it is suited for N <= 16k.
+     * With a thread pool, rows of the matrix are computed in parallel.
+     */
+    class BitsetNonDominatedSorter
+            : public NonDominatedSorter<F, P, C>
+    {
+    protected:
+        unsigned int m_nbWords;             ///> Number of words of a set of solutions.
+        std::vector< unsigned int > m_order;///> Index of the solution at each position of the lexicographic order.
+        std::vector< F > m_columns;         ///> Fitness values objective by objective in lexicographic order (objective o in [o*m_nbWords*64, (o+1)*m_nbWords*64[).
+        std::vector< uint64_t > m_matrix;   ///> Triangular domination matrix, bit q of row p is set if the solution at position q dominates the one at position p.
+
+        /**
+         * @brief rowOffset Get the position of a row in m_matrix, row p has p/64+1 words.
+         * @param position Position of the solution in lexicographic order.
+         * @return Offset of the first word of the row.
+         */
+        inline unsigned int rowOffset(const unsigned int position) const { const unsigned int block = position / 64; return 64 * (block*(block+1) / 2) + (position % 64)*(block+1); }
+
+        /**
+         * @brief computeMatrix Fill m_columns and m_matrix from m_fitness and m_order.
+         */
+        void computeMatrix();
+
+        /**
+         * @brief intersects Check if a solution is dominated by one of the solutions of a set.
+         * @param position Position of the solution in lexicographic order.
+         * @param set Set of positions.
+         * @return true if a solution of set dominates the solution at position.
+         */
+        bool intersects(const unsigned int position, const std::vector< uint64_t >& set) const;
+
+        virtual std::vector< Front > computeFronts();
+
+    public:
+        BitsetNonDominatedSorter();
+    };
+
+    /////////////////////////////////////////////////////////////
+    ///////////////////// NonDominatedSorter ////////////////////
+    /////////////////////////////////////////////////////////////
+
+    template<typename F, typename P, typename C>
+    NonDominatedSorter<F, P, C>::NonDominatedSorter()
+        : m_nbSolutions(0)
+        , m_nbObjectives(0)
+        , m_fitness()
+        , m_threadPool(nullptr)
+        , m_arena()
+    {
+    }
+
+    template<typename F, typename P, typename C>
+    NonDominatedSorter<F, P, C>::~NonDominatedSorter()
+    {
+    }
+
+    template<typename F, typename P, typename C>
+    void NonDominatedSorter<F, P, C>::loadFitness(const P* popToSort)
+    {
+        m_nbSolutions = popToSort->getCurrentNbChromosomes();
+        m_nbObjectives = m_nbSolutions == 0 ? 0 : popToSort->getChromosome(0).getNbObjective();
+
+        m_fitness.resize(m_nbSolutions*m_nbObjectives);
+        for (unsigned int i = 0 ; i < m_nbSolutions ; i++)
+        {
+            // Fitness may be stored in any container with random access iterators (std::vector, std::array)
+            const auto& fitness = popToSort->getChromosome(i).getFitness();
+            std::copy(fitness.begin(), fitness.begin() + m_nbObjectives, m_fitness.begin() + i*m_nbObjectives);
+        }
+    }
+
+    template<typename F, typename P, typename C>
+    bool NonDominatedSorter<F, P, C>::dominates(const unsigned int index1, const unsigned int index2) const
+    {
+        const F* fitness1 = fitness(index1);
+        const F* fitness2 = fitness(index2);
+
+        bool strictlyBetter = false;
+        for (unsigned int o = 0 ; o < m_nbObjectives ; ++o)
+        {
+            if (fitness1[o] > fitness2[o])
+                return false;
+            if (fitness1[o] < fitness2[o])
+                strictlyBetter = true;
+        }
+
+        return strictlyBetter;
+    }
+
+    template<typename F, typename P, typename C>
+    void NonDominatedSorter<F, P, C>::lexicographicOrder(std::vector< unsigned int >& order) const
+    {
+        order.resize(m_nbSolutions);
+        for (unsigned int i = 0 ; i < m_nbSolutions ; i++)
+            order[i] = i;
+
+        const NonDominatedSorter<F, P, C>* sorter = this;
+        std::sort(order.begin(), order.end(),
+                  [sorter](const unsigned int index1, const unsigned int index2)
+                  {
+                      return std::lexicographical_compare(sorter->fitness(index1), sorter->fitness(index1) + sorter->m_nbObjectives,
+                                                          sorter->fitness(index2), sorter->fitness(index2) + sorter->m_nbObjectives);
+                  });
+    }
+
+    template<typename F, typename P, typename C>
+    std::vector< Front > NonDominatedSorter<F, P, C>::sortTwoObjectives(const std::vector< unsigned int >& order) const
+    {
+        // Solutions are swept by increasing first objective, so the last solution added to a front
+        // is the one with the lowest second objective of this front and the only one that can dominate next solutions.
+        // Second objective of last solutions are increasing with fronts, that allows a binary search.
+        std::vector< Front > fronts;
+        std::vector< F > lastSecondObjective;
+
+        for (unsigned int i = 0 ; i < order.size() ; i++)
+        {
+            const unsigned int index = order[i];
+            const F secondObjective = fitness(index)[1];
+
+            // First front whose last solution doesn't dominate index
+            unsigned int f = std::upper_bound(lastSecondObjective.begin(), lastSecondObjective.end(), secondObjective) - lastSecondObjective.begin();
+            // Same solution than the last of the previous front, it belongs to this front
+            if (f > 0 && !dominates(fronts[f-1].back(), index))
+                f--;
+
+            if (f == fronts.size())
+            {
+                fronts.push_back(Front());
+                lastSecondObjective.push_back(secondObjective);
+            }
+            fronts[f].push_back(index);
+            lastSecondObjective[f] = secondObjective;
+        }
+
+        return fronts;
+    }
+
+    template<typename F, typename P, typename C>
+    void NonDominatedSorter<F, P, C>::writeRanks(P* popToSort, const std::vector< Front >& fronts)
+    {
+        for (unsigned int i = 0 ; i < fronts.size() ; i++)
+        {
+            for (unsigned int p = 0 ; p < fronts[i].size() ; p++)
+                popToSort->getChromosome(fronts[i][p]).setRank(i);
+        }
+    }
+
+    template<typename F, typename P, typename C>
+    std::vector< Front > NonDominatedSorter<F, P, C>::sort(P* popToSort)
+    {
+        loadFitness(popToSort);
+
+        std::vector< Front > fronts = computeFronts();
+
+        // Write ranks back to the population
+        writeRanks(popToSort, fronts);
+
+        return fronts;
+    }
+
+    template<typename F, typename P, typename C>
+    std::vector< Front > NonDominatedSorter<F, P, C>::sortFitnessMatrix(const F* fitness, const unsigned int nbSolutions, const unsigned int nbObjectives)
+    {
+        m_nbSolutions = nbSolutions;
+        m_nbObjectives = nbObjectives;
+        m_fitness.assign(fitness, fitness + nbSolutions*nbObjectives);
+
+        return computeFronts();
+    }
+
+    /////////////////////////////////////////////////////////////
+    /////////////////// FastNonDominatedSorter //////////////////
+    /////////////////////////////////////////////////////////////
+
+    template<typename F, typename P, typename C>
+    std::vector< Front > FastNonDominatedSorter<F, P, C>::sort(P* popToSort)
+    {
+        std::vector< Front > fronts = sortWith(popToSort->getCurrentNbChromosomes(),
+                                               [popToSort](const unsigned int p, const unsigned int q)
+                                               {
+                                                   return popToSort->getChromosome(p).dominates(popToSort->getChromosome(q));
+                                               });
+
+        // Write ranks back to the population
+        this->writeRanks(popToSort, fronts);
+
+        return fronts;
+    }
+
+    template<typename F, typename P, typename C>
+    std::vector< Front > FastNonDominatedSorter<F, P, C>::computeFronts()
+    {
+        const FastNonDominatedSorter<F, P, C>* sorter = this;
+        return sortWith(this->m_nbSolutions,
+                        [sorter](const unsigned int p, const unsigned int q)
+                        {
+                            return sorter->dominates(p, q);
+                        });
+    }
+
+    template<typename F, typename P, typename C>
+    template<typename Dominates>
+    std::vector< Front > FastNonDominatedSorter<F, P, C>::sortWith(const unsigned int nbChromosomes, const Dominates& dominates)
+    {
+        // Will contain all fronts
+        std::vector< Front > fronts;
+
+        if (nbChromosomes == 0)
+            return fronts;
+
+        // Sp grow while comparing, they keep their capacity from a sort to the next one (the arena would keep each regrowth)
+        // np has a fixed size and is taken in the arena
+        if (m_dominatedSolutions.size() < nbChromosomes)
+            m_dominatedSolutions.resize(nbChromosomes);
+        for (unsigned int p = 0 ; p < nbChromosomes ; p++)
+            m_dominatedSolutions[p].clear();
+        std::vector< std::vector< unsigned int > >& dominatedSolutions = m_dominatedSolutions;                  // Sp for each solution p
+        this->m_arena.reset();
+        std::vector< unsigned int, ArenaAllocator< unsigned int > > nbSolutionsDominatesMe(nbChromosomes, 0, ArenaAllocator< unsigned int >(&this->m_arena)); // np for each solution p
+
+        if (this->m_threadPool && this->m_threadPool->getNbThreads() > 1)
+        {
+            // Each row only writes Sp and np of its solution, so it compares p with all other solutions
+            // Sp is filled in increasing order of q like in the serial sort
+            this->m_threadPool->parallelFor(0, nbChromosomes,
+                                            [&dominates, nbChromosomes, &dominatedSolutions, &nbSolutionsDominatesMe](const unsigned int begin, const unsigned int end)
+                                            {
+                                                for (unsigned int p = begin ; p < end ; p++)
+                                                {
+                                                    for (unsigned int q = 0 ; q < nbChromosomes ; q++)
+                                                    {
+                                                        if (q == p)
+                                                            continue;
+
+                                                        if (dominates(p, q))                        // p dominates q
+                                                            dominatedSolutions[p].push_back(q);     // Sp = Sp U {q}
+                                                        else if (dominates(q, p))                   // q dominates p
+                                                            nbSolutionsDominatesMe[p]++;            // np + 1
+                                                    }
+                                                }
+                                            });
+        }
+        else
+        {
+            // Compare each pair of solutions only once
+            for (unsigned int p = 0 ; p < nbChromosomes ; p++)
+            {
+                for (unsigned int q = p+1 ; q < nbChromosomes ; q++)
+                {
+                    if (dominates(p, q))                            // p dominates q
+                    {
+                        dominatedSolutions[p].push_back(q);         // Sp = Sp U {q}
+                        nbSolutionsDominatesMe[q]++;                // nq + 1
+                    }
+                    else if (dominates(q, p))                       // q dominates p
+                    {
+                        dominatedSolutions[q].push_back(p);         // Sq = Sq U {p}
+                        nbSolutionsDominatesMe[p]++;                // np + 1
+                    }
+                }
+            }
+        }
+
+        // Determine first front : p belongs to it if np = 0
+        Front front;
+        for (unsigned int p = 0 ; p < nbChromosomes ; p++)
+        {
+            if (nbSolutionsDominatesMe[p] == 0)
+                front.push_back(p);
+        }
+
+        // Determine other fronts
+        while (!front.empty())
+        {
+            Front nextFront;    // Q
+            for (unsigned int p = 0 ; p < front.size() ; p++)
+            {
+                const std::vector< unsigned int >& dominated = dominatedSolutions[front[p]];
+                for (unsigned int q = 0 ; q < dominated.size() ; q++)
+                {
+                    if (--nbSolutionsDominatesMe[dominated[q]] == 0)    // q belongs to the next front, nq = 0
+                        nextFront.push_back(dominated[q]);              // Q = Q U {q}
+                }
+            }
+            fronts.push_back(front);
+            front.swap(nextFront);
+        }
+
+        return fronts;
+    }
+
+    /////////////////////////////////////////////////////////////
+    ///////////////// EfficientNonDominatedSorter ///////////////
+    /////////////////////////////////////////////////////////////
+
+    template<typename F, typename P, typename C>
+    EfficientNonDominatedSorter<F, P, C>::EfficientNonDominatedSorter(const SearchStrategy strategy)
+        : NonDominatedSorter<F, P, C>()
+        , m_strategy(strategy)
+    {
+    }
+
+    template<typename F, typename P, typename C>
+    bool EfficientNonDominatedSorter<F, P, C>::isDominatedByFront(const Front& front, const unsigned int index) const
+    {
+        // Last solutions added are the closest of index, begin by them
+        for (unsigned int i = front.size() ; i > 0 ; i--)
+        {
+            if (this->dominates(front[i-1], index))
+                return true;
+        }
+        return false;
+    }
+
+    template<typename F, typename P, typename C>
+    std::vector< Front > EfficientNonDominatedSorter<F, P, C>::computeFronts()
+    {
+
+        std::vector< unsigned int > order;
+        this->lexicographicOrder(order);
+
+        std::vector< Front > fronts;
+        if (this->m_nbObjectives == 2)
+            fronts = this->sortTwoObjectives(order);
+        else
+        {
+            for (unsigned int i = 0 ; i < order.size() ; i++)
+            {
+                const unsigned int index = order[i];
+                unsigned int f = fronts.size();     // Front of index, a new one if none fits
+
+                if (m_strategy == SEQUENTIAL_SEARCH)
+                {
+                    for (unsigned int k = 0 ; k < fronts.size() ; k++)
+                    {
+                        if (!isDominatedByFront(fronts[k], index))
+                        {
+                            f = k;
+                            break;
+                        }
+                    }
+                }
+                else
+                {
+                    // If index is dominated by a solution of front k, it is dominated by a solution of each front before k
+                    unsigned int min = 0;
+                    unsigned int max = fronts.size();
+                    while (min < max)
+                    {
+                        const unsigned int middle = (min + max) / 2;
+                        if (isDominatedByFront(fronts[middle], index))
+                            min = middle + 1;
+                        else
+                            max = middle;
+                    }
+                    f = min;
+                }
+
+                if (f == fronts.size())
+                    fronts.push_back(Front());
+                fronts[f].push_back(index);
+            }
+        }
+
+        return fronts;
+    }
+
+    /////////////////////////////////////////////////////////////
+    ///////////////////// JensenFortinSorter ////////////////////
+    /////////////////////////////////////////////////////////////
+
+    template<typename F, typename P, typename C>
+    std::vector< Front > JensenFortinSorter<F, P, C>::computeFronts()
+    {
+
+        std::vector< unsigned int > order;
+        this->lexicographicOrder(order);
+
+        std::vector< Front > fronts;
+        if (this->m_nbObjectives == 2)
+            fronts = this->sortTwoObjectives(order);
+        else if (!order.empty())
+        {
+            const unsigned int nbObjectives = this->m_nbObjectives;
+
+            // Merge duplicated solutions, they will share the rank of the first of them
+            std::vector< unsigned int > uniqueSolutions;            // Index of the first solution of each group of duplicated solutions
+            std::vector< unsigned int > uniqueOf(order.size());     // Group of each solution
+            for (unsigned int i = 0 ; i < order.size() ; i++)
+            {
+                if (uniqueSolutions.empty()
+                        || !std::equal(this->fitness(order[i]), this->fitness(order[i]) + nbObjectives, this->fitness(uniqueSolutions.back())))
+                    uniqueSolutions.push_back(order[i]);
+                uniqueOf[order[i]] = uniqueSolutions.size() - 1;
+            }
+            const unsigned int nbUnique = uniqueSolutions.size();
+
+            // Replace objective values by their position in the order (value, lexicographic position)
+            // Equal values are so distinguished without breaking dominance relations between distinct solutions
+            m_keys.assign(nbUnique*nbObjectives, 0);
+            std::vector< unsigned int > objectiveOrder(nbUnique);
+            for (unsigned int o = 0 ; o < nbObjectives ; o++)
+            {
+                for (unsigned int i = 0 ; i < nbUnique ; i++)
+                    objectiveOrder[i] = i;
+
+                const JensenFortinSorter<F, P, C>* sorter = this;
+                std::stable_sort(objectiveOrder.begin(), objectiveOrder.end(),
+                                 [sorter, &uniqueSolutions, o](const unsigned int index1, const unsigned int index2)
+                                 {
+                                     return sorter->fitness(uniqueSolutions[index1])[o] < sorter->fitness(uniqueSolutions[index2])[o];
+                                 });
+
+                for (unsigned int i = 0 ; i < nbUnique ; i++)
+                    m_keys[objectiveOrder[i]*nbObjectives + o] = i;
+            }
+
+            m_ranks.assign(nbUnique, 0);
+            std::vector< unsigned int > S(nbUnique);
+            for (unsigned int i = 0 ; i < nbUnique ; i++)
+                S[i] = i;
+            if (nbObjectives < 2)
+            {
+                // Solutions are all different and sorted, each one dominates the next one
+                for (unsigned int i = 0 ; i < nbUnique ; i++)
+                    m_ranks[i] = i;
+            }
+            else
+                helperA(S, nbObjectives-1);
+
+            // Build fronts from ranks
+            for (unsigned int i = 0 ; i < order.size() ; i++)
+            {
+                const unsigned int rank = m_ranks[uniqueOf[order[i]]];
+                if (rank >= fronts.size())
+                    fronts.resize(rank+1);
+                fronts[rank].push_back(order[i]);
+            }
+        }
+
+        return fronts;
+    }
+
+    template<typename F, typename P, typename C>
+    void JensenFortinSorter<F, P, C>::helperA(const std::vector< unsigned int >& S, const unsigned int k)
+    {
+        if (S.size() < 2)
+            return;
+        if (k == 1)
+        {
+            sweepA(S);
+            return;
+        }
+
+        // Split S on the median of objective k, keeping the order on first objective
+        const unsigned int median = medianKey(S, std::vector< unsigned int >(), k);
+        std::vector< unsigned int > L, H;
+        for (unsigned int i = 0 ; i < S.size() ; i++)
+        {
+            if (key(S[i], k) < median)
+                L.push_back(S[i]);
+            else
+                H.push_back(S[i]);
+        }
+
+        helperA(L, k);
+        helperB(L, H, k-1);
+        helperA(H, k);
+    }
+
+    template<typename F, typename P, typename C>
+    void JensenFortinSorter<F, P, C>::helperB(const std::vector< unsigned int >& L, const std::vector< unsigned int >& H, const unsigned int k)
+    {
+        if (L.empty() || H.empty())
+            return;
+
+        if (L.size() == 1 || H.size() == 1)
+        {
+            for (unsigned int h = 0 ; h < H.size() ; h++)
+            {
+                for (unsigned int l = 0 ; l < L.size() ; l++)
+                {
+                    bool dominates = true;
+                    for (unsigned int o = 0 ; o <= k && dominates ; o++)
+                        dominates = key(L[l], o) < key(H[h], o);
+                    if (dominates)
+                        m_ranks[H[h]] = std::max(m_ranks[H[h]], m_ranks[L[l]] + 1);
+                }
+            }
+            return;
+        }
+
+        if (k == 1)
+        {
+            sweepB(L, H);
+            return;
+        }
+
+        unsigned int minL = key(L[0], k), maxL = minL;
+        for (unsigned int i = 1 ; i < L.size() ; i++)
+        {
+            minL = std::min(minL, key(L[i], k));
+            maxL = std::max(maxL, key(L[i], k));
+        }
+        unsigned int minH = key(H[0], k), maxH = minH;
+        for (unsigned int i = 1 ; i < H.size() ; i++)
+        {
+            minH = std::min(minH, key(H[i], k));
+            maxH = std::max(maxH, key(H[i], k));
+        }
+
+        if (maxL < minH)        // L is better than H on objective k
+            helperB(L, H, k-1);
+        else if (minL < maxH)   // Else no solution of L can dominate a solution of H
+        {
+            const unsigned int median = medianKey(L, H, k);
+            std::vector< unsigned int > L1, L2, H1, H2;
+            for (unsigned int i = 0 ; i < L.size() ; i++)
+            {
+                if (key(L[i], k) < median)
+                    L1.push_back(L[i]);
+                else
+                    L2.push_back(L[i]);
+            }
+            for (unsigned int i = 0 ; i < H.size() ; i++)
+            {
+                if (key(H[i], k) < median)
+                    H1.push_back(H[i]);
+                else
+                    H2.push_back(H[i]);
+            }
+
+            helperB(L1, H1, k);
+            helperB(L1, H2, k-1);
+            helperB(L2, H2, k);
+        }
+    }
+
+    template<typename F, typename P, typename C>
+    void JensenFortinSorter<F, P, C>::sweepA(const std::vector< unsigned int >& S)
+    {
+        std::map< unsigned int, unsigned int > stair;
+        for (unsigned int i = 0 ; i < S.size() ; i++)
+        {
+            m_ranks[S[i]] = std::max(m_ranks[S[i]], rankFromStair(stair, S[i]));
+            insertInStair(stair, S[i]);
+        }
+    }
+
+    template<typename F, typename P, typename C>
+    void JensenFortinSorter<F, P, C>::sweepB(const std::vector< unsigned int >& L, const std::vector< unsigned int >& H)
+    {
+        std::map< unsigned int, unsigned int > stair;
+        unsigned int l = 0;
+        for (unsigned int h = 0 ; h < H.size() ; h++)
+        {
+            // Add solutions of L before H[h] on the first objective
+            while (l < L.size() && key(L[l], 0) < key(H[h], 0))
+            {
+                insertInStair(stair, L[l]);
+                l++;
+            }
+            m_ranks[H[h]] = std::max(m_ranks[H[h]], rankFromStair(stair, H[h]));
+        }
+    }
+
+    template<typename F, typename P, typename C>
+    void JensenFortinSorter<F, P, C>::insertInStair(std::map< unsigned int, unsigned int >& stair, const unsigned int index) const
+    {
+        const unsigned int rank = m_ranks[index];
+        std::map< unsigned int, unsigned int >::iterator it = stair.upper_bound(key(index, 1));
+        // A solution before index has already a greater or equal rank, index is useless
+        if (it != stair.begin())
+        {
+            std::map< unsigned int, unsigned int >::iterator previous = it;
+            if ((--previous)->second >= rank)
+                return;
+        }
+        // Remove solutions after index with a lower or equal rank
+        while (it != stair.end() && it->second <= rank)
+            it = stair.erase(it);
+        stair[key(index, 1)] = rank;
+    }
+
+    template<typename F, typename P, typename C>
+    unsigned int JensenFortinSorter<F, P, C>::rankFromStair(const std::map< unsigned int, unsigned int >& stair, const unsigned int index) const
+    {
+        // Solution of the stair with the greatest second objective lower than those of index has the highest rank
+        std::map< unsigned int, unsigned int >::const_iterator it = stair.lower_bound(key(index, 1));
+        if (it == stair.begin())
+            return 0;
+        --it;
+        return it->second + 1;
+    }
+
+    template<typename F, typename P, typename C>
+    unsigned int JensenFortinSorter<F, P, C>::medianKey(const std::vector< unsigned int >& first, const std::vector< unsigned int >& second, const unsigned int k) const
+    {
+        std::vector< unsigned int > keys;
+        keys.reserve(first.size() + second.size());
+        for (unsigned int i = 0 ; i < first.size() ; i++)
+            keys.push_back(key(first[i], k));
+        for (unsigned int i = 0 ; i < second.size() ; i++)
+            keys.push_back(key(second[i], k));
+
+        // Upper median, so that the lower part is never empty
+        std::nth_element(keys.begin(), keys.begin() + keys.size()/2, keys.end());
+        return keys[keys.size()/2];
+    }
+
+    /////////////////////////////////////////////////////////////
+    ////////////////// BitsetNonDominatedSorter /////////////////
+    /////////////////////////////////////////////////////////////
+
+    template<typename F>
+    inline void compareWithBlock(const F* block, const F value, uint64_t& lowerOrEqual, uint64_t& lower)
+    {
+        lowerOrEqual = 0;
+        lower = 0;
+        for (unsigned int b = 0 ; b < 64 ; b++)
+        {
+            lowerOrEqual |= uint64_t(block[b] <= value) << b;
+            lower |= uint64_t(block[b] < value) << b;
+        }
+    }
+
+    inline void compareWithBlock(const double* block, const double value, uint64_t& lowerOrEqual, uint64_t& lower)
+    {
+        lowerOrEqual = 0;
+        lower = 0;
+#if defined(__AVX__)
+        const __m256d values = _mm256_set1_pd(value);
+        for (unsigned int b = 0 ; b < 64 ; b += 4)
+        {
+            const __m256d blockValues = _mm256_loadu_pd(block + b);
+            lowerOrEqual |= uint64_t(_mm256_movemask_pd(_mm256_cmp_pd(blockValues, values, _CMP_LE_OQ))) << b;
+            lower |= uint64_t(_mm256_movemask_pd(_mm256_cmp_pd(blockValues, values, _CMP_LT_OQ))) << b;
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        const __m128d values = _mm_set1_pd(value);
+        for (unsigned int b = 0 ; b < 64 ; b += 2)
+        {
+            const __m128d blockValues = _mm_loadu_pd(block + b);
+            lowerOrEqual |= uint64_t(_mm_movemask_pd(_mm_cmple_pd(blockValues, values))) << b;
+            lower |= uint64_t(_mm_movemask_pd(_mm_cmplt_pd(blockValues, values))) << b;
+        }
+#else
+        compareWithBlock<double>(block, value, lowerOrEqual, lower);
+#endif
+    }
+
+    inline void compareWithBlock(const float* block, const float value, uint64_t& lowerOrEqual, uint64_t& lower)
+    {
+        lowerOrEqual = 0;
+        lower = 0;
+#if defined(__AVX__)
+        const __m256 values = _mm256_set1_ps(value);
+        for (unsigned int b = 0 ; b < 64 ; b += 8)
+        {
+            const __m256 blockValues = _mm256_loadu_ps(block + b);
+            lowerOrEqual |= uint64_t(_mm256_movemask_ps(_mm256_cmp_ps(blockValues, values, _CMP_LE_OQ))) << b;
+            lower |= uint64_t(_mm256_movemask_ps(_mm256_cmp_ps(blockValues, values, _CMP_LT_OQ))) << b;
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        const __m128 values = _mm_set1_ps(value);
+        for (unsigned int b = 0 ; b < 64 ; b += 4)
+        {
+            const __m128 blockValues = _mm_loadu_ps(block + b);
+            lowerOrEqual |= uint64_t(_mm_movemask_ps(_mm_cmple_ps(blockValues, values))) << b;
+            lower |= uint64_t(_mm_movemask_ps(_mm_cmplt_ps(blockValues, values))) << b;
+        }
+#else
+        compareWithBlock<float>(block, value, lowerOrEqual, lower);
+#endif
+    }
+
+    template<typename F, typename P, typename C>
+    BitsetNonDominatedSorter<F, P, C>::BitsetNonDominatedSorter()
+        : NonDominatedSorter<F, P, C>()
+        , m_nbWords(0)
+        , m_order()
+        , m_columns()
+        , m_matrix()
+    {
+    }
+
+    template<typename F, typename P, typename C>
+    void BitsetNonDominatedSorter<F, P, C>::computeMatrix()
+    {
+        const unsigned int nbSolutions = this->m_nbSolutions;
+        const unsigned int nbObjectives = this->m_nbObjectives;
+        const unsigned int nbColumns = m_nbWords*64;
+
+        // Structure of arrays : one contiguous column per objective, padded to a multiple of 64
+        m_columns.assign(nbObjectives*nbColumns, F());
+        for (unsigned int p = 0 ; p < nbSolutions ; p++)
+        {
+            for (unsigned int o = 0 ; o < nbObjectives ; o++)
+                m_columns[o*nbColumns + p] = this->fitness(m_order[p])[o];
+        }
+
+        m_matrix.resize(rowOffset(nbSolutions));
+
+        BitsetNonDominatedSorter<F, P, C>* sorter = this;
+        std::function<void(unsigned int, unsigned int)> computeRows = [sorter, nbObjectives, nbColumns](const unsigned int begin, const unsigned int end)
+        {
+            for (unsigned int p = begin ; p < end ; p++)
+            {
+                uint64_t* dominatedBy = &sorter->m_matrix[sorter->rowOffset(p)];
+                const unsigned int lastWord = p / 64;
+                for (unsigned int w = 0 ; w <= lastWord ; w++)
+                {
+                    uint64_t noWorse = ~uint64_t(0);    // q <= p on all objectives
+                    uint64_t better = 0;                // q < p on at least one objective
+                    for (unsigned int o = 0 ; o < nbObjectives && noWorse ; o++)
+                    {
+                        uint64_t lowerOrEqual, lower;
+                        compareWithBlock(&sorter->m_columns[o*nbColumns + w*64], sorter->m_columns[o*nbColumns + p], lowerOrEqual, lower);
+                        noWorse &= lowerOrEqual;
+                        better |= lower;
+                    }
+                    dominatedBy[w] = noWorse & better;
+                }
+                // Only solutions before p can dominate it
+                dominatedBy[lastWord] &= (uint64_t(1) << (p % 64)) - 1;
+            }
+        };
+
+        if (this->m_threadPool)
+            this->m_threadPool->parallelFor(0, nbSolutions, computeRows, 64);
+        else
+            computeRows(0, nbSolutions);
+    }
+
+    template<typename F, typename P, typename C>
+    bool BitsetNonDominatedSorter<F, P, C>::intersects(const unsigned int position, const std::vector< uint64_t >& set) const
+    {
+        const uint64_t* dominatedBy = &m_matrix[rowOffset(position)];
+        const unsigned int lastWord = position / 64;
+        for (unsigned int w = 0 ; w <= lastWord ; w++)
+        {
+            if (dominatedBy[w] & set[w])
+                return true;
+        }
+        return false;
+    }
+
+    template<typename F, typename P, typename C>
+    std::vector< Front > BitsetNonDominatedSorter<F, P, C>::computeFronts()
+    {
+
+        std::vector< Front > fronts;
+        if (this->m_nbSolutions == 0)
+            return fronts;
+
+        m_nbWords = (this->m_nbSolutions + 63) / 64;
+        this->lexicographicOrder(m_order);
+        computeMatrix();
+
+        // Dominating solutions are always before in lexicographic order, so they already have their front
+        // and if a solution is dominated by a solution of front k, it is dominated by a solution of each front before k
+        std::vector< std::vector< uint64_t > > frontSets;  // Bit set of positions of each front
+        for (unsigned int p = 0 ; p < this->m_nbSolutions ; p++)
+        {
+            // Count solutions dominating p
+            const uint64_t* dominatedBy = &m_matrix[rowOffset(p)];
+            unsigned int nbDominatesMe = 0;
+            for (unsigned int w = 0 ; w <= p / 64 ; w++)
+                nbDominatesMe += popCount(dominatedBy[w]);
+
+            unsigned int f = 0;
+            if (nbDominatesMe != 0)
+            {
+                unsigned int max = fronts.size();
+                while (f < max)
+                {
+                    const unsigned int middle = (f + max) / 2;
+                    if (intersects(p, frontSets[middle]))
+                        f = middle + 1;
+                    else
+                        max = middle;
+                }
+            }
+
+            if (f == fronts.size())
+            {
+                fronts.push_back(Front());
+                frontSets.push_back(std::vector< uint64_t >(m_nbWords, 0));
+            }
+            fronts[f].push_back(m_order[p]);
+            frontSets[f][p / 64] |= uint64_t(1) << (p % 64);
+        }
+
+        return fronts;
+    }
+
+}
+
+#endif // NONDOMINATEDSORTING_H
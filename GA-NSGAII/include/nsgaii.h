@@ -4,6 +4,7 @@
 #include <iostream>
 
 #include "ga.h"
+#include "nondominatedsorting.h"
 
 namespace smoga
 {
@@ -16,39 +17,57 @@ namespace smoga
 
         P* m_offspring; ///> Offspring of m_population.
         bool m_consoleDisplay; ///> To have a display in console.
+        NonDominatedSorter<F, P, C>* m_sorter; ///> Engine used to determine non-dominated fronts.
+        Arena m_arena; ///> Memory of the temporary datas of a generation, reset at the beginning of each generation.
 
         virtual void releaseMemory();
+        virtual void updatePopulations();
 
         /**
-         * @brief breeding Perform GA operators (selection, crossover, mutation) on m_population.
-         * @return The offspring population.
+         * @brief breeding Perform GA operators (selection, crossover, mutation) on m_population, then evaluate the offspring.
+         * The offspring replace the chromosomes of m_offspring, whose storage is reused.
          */
-        virtual P* breeding();
+        virtual void breeding();
 
         /**
-         * @brief fastNonDominatedSort Determine all non-dominated front of the Population in parameter.
+         * @brief fastNonDominatedSort Determine all non-dominated front of the Population in parameter using m_sorter.
+         * Chromosomes are never copied, fronts only store their indexes in popToSort and ranks are written back once at the end.
          * @param popToSort Population to search non-dominated fronts.
          * @return Vector of non-dominated fronts, fisrt element correspond to front 1 and so on.
          */
-        virtual std::vector < P > fastNonDominatedSort(P* popToSort);
+        virtual std::vector< Front > fastNonDominatedSort(P* popToSort);
 
         /**
-         * @brief crowdingDistanceAssignement Compute the crowding distance on the popualtion in parameter.
+         * @brief crowdingDistanceAssignement Compute the crowding distance on a front of the popualtion in parameter.
+         * With a thread pool, objectives are sorted concurrently and their contributions summed in the same order than the serial computation.
          * @param popToAssignCrowdingDistance Population which we want to compute crowding distance.
+         * @param front Indexes of the chromosomes of popToAssignCrowdingDistance composing the front.
          */
-        virtual void crowdingDistanceAssignement(P* popToAssignCrowdingDistance);
+        virtual void crowdingDistanceAssignement(P* popToAssignCrowdingDistance, const Front& front);
 
         /**
-         * @brief addChromosomeWithoutControl Add a Chromosome chromosome to the population pop, if pop will be full, it add the chromosome and increment max Population size by one.
-         * @param pop Population that we want to add Chromosome.
-         * @param chromosome Chromosome to add.
+         * @brief displayAdvancement Display in the console advancement of the algorithm.
          */
-        virtual void addChromosomeWithoutControl(P* pop, C* chromosome);
+        virtual void displayAdvancement();
 
         /**
-         * @brief displayAdvancement Display in the console advancement of the algorithm.
+         * @brief logGeneration Write the current population in the run log, with the rank and crowding distance of each chromosome.
          */
-        virtual void displayAdvancement();
+        virtual void logGeneration();
+
+        /**
+         * @brief writeCheckpoint Write the state of the algorithm, with the offspring of the current population.
+         * @param checkpoint Checkpoint receiving the state.
+         */
+        virtual void writeCheckpoint(CheckpointWriter& checkpoint) const;
+        virtual void readCheckpoint(CheckpointReader& checkpoint);
+        /**
+         * @brief writeChromosomeStates Write the rank and the crowding distance of the chromosomes of a population.
+         * @param checkpoint Checkpoint receiving the states.
+         * @param population Population to write.
+         */
+        virtual void writeChromosomeStates(CheckpointWriter& checkpoint, const P& population) const;
+        virtual void readChromosomeStates(CheckpointReader& checkpoint, P& population) const;
 
     public:
         NSGAII(bool consoleDisplay = true);
@@ -76,6 +95,19 @@ namespace smoga
          * @return Bool of the state (m_consoleDisplay).
          */
         inline bool getConsoleDsiplay() const { return m_consoleDisplay; }
+
+        /**
+         * @brief setNonDominatedSorter Set the engine used to determine non-dominated fronts (FastNonDominatedSorter by default).
+         * @param sorter Engine to use, NSGAII takes its ownership.
+         */
+        void setNonDominatedSorter(NonDominatedSorter<F, P, C>* sorter);
+        /**
+         * @brief getNonDominatedSorter Get the engine used to determine non-dominated fronts.
+         * @return The engine.
+         */
+        inline NonDominatedSorter<F, P, C>* getNonDominatedSorter() const { return m_sorter; }
+
+        virtual void setNbThreads(const unsigned int nbThreads);
     };
 
     template<typename F, typename P, typename C>
@@ -83,6 +115,8 @@ namespace smoga
         : GA<F, P, C>()
         , m_offspring(nullptr)
         , m_consoleDisplay(consoleDisplay)
+        , m_sorter(new FastNonDominatedSorter<F, P, C>)
+        , m_arena()
     {
     }
 
@@ -90,6 +124,37 @@ namespace smoga
     NSGAII<F, P, C>::~NSGAII()
     {
         releaseMemory();
+        delete m_sorter;
+    }
+
+    template<typename F, typename P, typename C>
+    void NSGAII<F, P, C>::setNonDominatedSorter(NonDominatedSorter<F, P, C>* sorter)
+    {
+        if (!sorter)
+            throw std::runtime_error("Invalid non-dominated sorting engine!");
+
+        if (sorter != m_sorter)
+            delete m_sorter;
+        m_sorter = sorter;
+        m_sorter->setThreadPool(this->m_threadPool);
+    }
+
+    template<typename F, typename P, typename C>
+    void NSGAII<F, P, C>::setNbThreads(const unsigned int nbThreads)
+    {
+        GA<F, P, C>::setNbThreads(nbThreads);
+        m_sorter->setThreadPool(this->m_threadPool);
+    }
+
+    template<typename F, typename P, typename C>
+    void NSGAII<F, P, C>::updatePopulations()
+    {
+        GA<F, P, C>::updatePopulations();
+        if (m_offspring)
+        {
+            m_offspring->setThreadPool(this->m_threadPool);
+            m_offspring->setFitnessCache(this->m_fitnessCache);
+        }
     }
 
     template<typename F, typename P, typename C>
@@ -104,11 +169,14 @@ namespace smoga
     template<typename F, typename P, typename C>
     void NSGAII<F, P, C>::runOneGeneration()
     {
-        // Combine parent and offsprings population
-        this->m_population->add(*m_offspring);
+        // Temporary datas of the previous generation aren't used anymore
+        m_arena.reset();
+
+        // Combine parent and offsprings population, offspring are moved and keep their fitness
+        this->m_population->merge(*m_offspring);
 
         // Determine all non dominated fronts
-        std::vector < P > fronts = fastNonDominatedSort(this->m_population);
+        std::vector< Front > fronts = fastNonDominatedSort(this->m_population);
 
         // Secure check if it's not empty (should never arrived)
         if (fronts.empty())
@@ -117,212 +185,148 @@ namespace smoga
             return;
         }
 
-        P* newParents = new P;  // Future population
-        int i = 0;              // Index front
+        P* newParents = this->prepareNextPopulation();     // Future population
+        unsigned int i = 0;         // Index front
         // Until the population is filled
-        while (newParents->getCurrentNbChromosomes() + fronts[i].getCurrentNbChromosomes() <= newParents->getNbMaxChromosomes())
+        while (i < fronts.size()
+               && newParents->getCurrentNbChromosomes() + fronts[i].size() <= (unsigned int)newParents->getNbMaxChromosomes())
         {
             // Calculate crowding-distance in ith Front
-            crowdingDistanceAssignement(&fronts[i]);
+            crowdingDistanceAssignement(this->m_population, fronts[i]);
 
-            // Include ith non-dominated front in the population
-            newParents->addChromosomes(fronts[i].getChromosomes());
+            // Include ith non-dominated front in the population,
+            // chromosomes are moved because each one belongs to a single front and m_population is recycled afterwards
+            for (unsigned int c = 0 ; c < fronts[i].size() ; c++)
+                newParents->addChromosome(std::move(this->m_population->getChromosome(fronts[i][c])));
             i++;    // Check the next front for inclusion
         }
 
-        if (!newParents->isFull())
+        if (!newParents->isFull() && i < fronts.size())
         {
             // Calculate crowding-distance in ith Front, because previous loop stop just before calculate these values
-            crowdingDistanceAssignement(&fronts[i]);
-            std::vector< C > chromosomes = fronts[i].getChromosomes();
+            crowdingDistanceAssignement(this->m_population, fronts[i]);
 
             // Sort in descending order the ith front using crowding operator
-            std::sort(chromosomes.begin(), chromosomes.end(), CrowdingOperator< C >());
+            CrowdingIndexOperator< P > comparator;
+            comparator.population = this->m_population;
+            std::sort(fronts[i].begin(), fronts[i].end(), comparator);
 
             // Choose the first (max chromosomes - size newParents) of ith front
-            newParents->addChromosomes(chromosomes, newParents->getNbMaxChromosomes() - newParents->getCurrentNbChromosomes());
+            const unsigned int nbMissing = newParents->getNbMaxChromosomes() - newParents->getCurrentNbChromosomes();
+            for (unsigned int c = 0 ; c < nbMissing ; c++)
+                newParents->addChromosome(std::move(this->m_population->getChromosome(fronts[i][c])));
         }
 
-        delete this->m_population;
-        this->m_population = new P;
-        *this->m_population = *newParents;
-        // Use selection, crossover and mutation to create new offspring population
-        delete m_offspring;
+        // The merged population becomes the buffer of the next generation
+        std::swap(this->m_population, this->m_nextPopulation);
         // Execute breeding (create offspring using GA)
-        m_offspring = breeding();
+        breeding();
+
+        if (!this->m_runLogFileName.empty())
+            logGeneration();
 
         // Only for Display
         if (m_consoleDisplay)
             displayAdvancement();
 
         this->m_currentGeneration++;    // Generation counter
+        this->checkpointGeneration();
     }
 
     template<typename F, typename P, typename C>
-    P* NSGAII<F, P, C>::breeding()
+    void NSGAII<F, P, C>::breeding()
     {
-        P* newPop = new P;
-
-        while (!newPop->isFull())
-        {
-            // CrossOver only if prob <= prob crossover
-            std::uniform_real_distribution<float> distribution(0.0, 1.0);
-            float probaCrossOver = distribution(generator);
-
-            C chromosome;
-            if (probaCrossOver <= P::getCrossOverProbability()) // Crossover
-            {
-                chromosome = this->m_population->crossOver(this->m_population->selectChromosomesPair());
-                newPop->addChromosome(chromosome);
-            }
-            else    // Don't Crossover
-            {
-                chromosome = this->m_population->selectOneChromosome();
-                newPop->addChromosome(chromosome);
-            }
-        }
+        if (!m_offspring)
+            m_offspring = this->createPopulation();
+        m_offspring->recycle();
 
-        newPop->mutate();
-        newPop->evaluateFitness();
-
-        return newPop;
+        // Offspring are selected, crossed over, mutated and evaluated at once
+        m_offspring->breed(*this->m_population, this->nextRandomStage());
+        m_offspring->prepareSelection();
     }
 
     template<typename F, typename P, typename C>
-    std::vector< P > NSGAII<F, P, C>::fastNonDominatedSort(P* popToSort)
+    std::vector< Front > NSGAII<F, P, C>::fastNonDominatedSort(P* popToSort)
     {
-        // Will contain all fronts
-        std::vector< P > fronts;
-
-        // Recover population's vector of chomosomes
-        std::vector< C > chromosomes = popToSort->getChromosomes();
-        P* front1 = new P;
-        // Determine first front
-        for (unsigned int p = 0 ; p < chromosomes.size() ; p++)
-        {
-            // Sp = void | np = 0
-            chromosomes[p].resetDominance();
-            for (unsigned int q = 0 ; q < chromosomes.size() ; q++ )
-            {
-                if (chromosomes[p] == chromosomes[q]) // case when we compare same chromosomes
-                    continue;
-
-                if (chromosomes[p].dominates(chromosomes[q]))       // p dominates q
-                    chromosomes[p].addDominatedSolution(&chromosomes[q]);    // Sp = Sp U {p}
-                else if (chromosomes[q].dominates(chromosomes[p]))  // q dominates p
-                    chromosomes[p].setNbSolutionDominatesMe(chromosomes[p].getNbSolutionDominatesMe()+1);   // np + 1
-            }
-
-            // p belongs to the first front
-            if (chromosomes[p].getNbSolutionDominatesMe() == 0)
-            {
-                chromosomes[p].setRank(0);
-                addChromosomeWithoutControl(front1, &chromosomes[p]);
-            }
-        }
-        fronts.push_back(*front1);
-        delete front1;
-        // Reaffect chromosomes to the population to sort
-        popToSort->setChromosomes(chromosomes);
-
-        // Determine other fronts
-        int i = 0; // Initialize front counter
-        P* Q = new P;
-        while (fronts[i].getCurrentNbChromosomes() != 0)
-        {
-            Q->reset();
-            for (unsigned int p = 0 ; p < fronts[i].getChromosomes().size() ; p++)
-            {
-                for (unsigned int q = 0 ; q < fronts[i].getChromosomes()[p].getDominatedSolution().size() ; q++)
-                {
-                    int nq = fronts[i].getChromosomes()[p].getDominatedSolution()[q]->getNbSolutionDominatesMe();
-                    fronts[i].getChromosomes()[p].getDominatedSolution()[q]->setNbSolutionDominatesMe(nq-1);
-                    if (fronts[i].getChromosomes()[p].getDominatedSolution()[q]->getNbSolutionDominatesMe() == 0)    // q belongs to the next front, nq = 0
-                    {
-                        fronts[i].getChromosomes()[p].getDominatedSolution()[q]->setRank(i+1);   // qrank = i + 1
-                        addChromosomeWithoutControl(Q, fronts[i].getChromosomes()[p].getDominatedSolution()[q]);    // Q = Q U {q}
-                    }
-                }
-            }
-            i++;
-            fronts.push_back(*Q);
-        }
-        // Delete fronts created if it is empty.
-        auto removeEnd = std::remove_if(fronts.begin(), fronts.end(), EmptyPopulation< P >());
-        if (removeEnd != fronts.end())
-            fronts.erase(removeEnd, fronts.end());
-
-        return fronts;
+        return m_sorter->sort(popToSort);
     }
 
     template<typename F, typename P, typename C>
-    void NSGAII<F, P, C>::crowdingDistanceAssignement(P* popToAssignCrowdingDistance)
+    void NSGAII<F, P, C>::crowdingDistanceAssignement(P* popToAssignCrowdingDistance, const Front& front)
     {
-        if (popToAssignCrowdingDistance->getChromosomes().empty())
+        if (front.empty())
             return;
 
-        // Number of solutions in popToAssignCrowdingDistance
-        unsigned int nbSolutions = popToAssignCrowdingDistance->getCurrentNbChromosomes();
-        std::vector< C > chromosomes = popToAssignCrowdingDistance->getChromosomes();
+        // Number of solutions in the front
+        const unsigned int nbSolutions = front.size();
+        const unsigned int nbObjective = popToAssignCrowdingDistance->getChromosome(front[0]).getNbObjective();
 
-        // Initialize distance to 0
-        for (unsigned int i = 0 ; i < nbSolutions ; i++)
-            chromosomes[i].setDistance(0);
+        if (nbSolutions <= 2)
+        {
+            // Alone solution has a null distance, a pair of solutions are both boundary points
+            const double distance = nbSolutions == 1 || nbObjective == 0 ? 0 : std::numeric_limits<double>::max();
+            for (unsigned int i = 0 ; i < nbSolutions ; i++)
+                popToAssignCrowdingDistance->getChromosome(front[i]).setDistance(distance);
+            return;
+        }
 
-        // Normaly it has to sort in ascending order
-        Ascending< C > comparator;    // Comparator using to sort on ascending order each objectives
-        unsigned int nbObjective = chromosomes[0].getNbObjective();
+        // Contribution of each objective to the distance of each solution, boundary points have an infinite contribution
+        // Objective m in [m*nbSolutions, (m+1)*nbSolutions[, taken in the arena of the generation like the sorted fitness
+        std::vector< double, ArenaAllocator< double > > contributions(nbObjective*nbSolutions, 0, ArenaAllocator< double >(&m_arena));
 
-        for (unsigned int m = 0 ; m < nbObjective ; m++)
+        const P* population = popToAssignCrowdingDistance;
+        Arena* arena = &m_arena;
+        std::function<void(unsigned int, unsigned int)> computeContributions = [population, &front, nbSolutions, &contributions, arena](const unsigned int begin, const unsigned int end)
         {
-            // Sort using each objective value
-            comparator.index = m;
-            std::sort(chromosomes.begin(),
-                      chromosomes.end(),
-                      comparator);
-
-            // Assigne value of max minus min of fitness for the objective m
-            F maxMinusMinFitness = chromosomes[nbSolutions-1].getFitness()[m] - chromosomes[0].getFitness()[m];
-
-            if (maxMinusMinFitness == 0) // Little cheat to prevent division by 0
-                maxMinusMinFitness = 0.00001;
-            if (chromosomes.size() == 1)    // Alone solution
+            // Normaly it has to sort in ascending order
+            // Fitness values are gathered once per objective, then sorted with the position of their solution in the front
+            std::vector< std::pair< F, unsigned int >, ArenaAllocator< std::pair< F, unsigned int > > > sortedFitness(nbSolutions, std::pair< F, unsigned int >(), ArenaAllocator< std::pair< F, unsigned int > >(arena));
+            for (unsigned int m = begin ; m < end ; m++)
             {
-                chromosomes[0].setDistance(0);
-                continue;
-            }
-            else if (chromosomes.size() == 2)
-            {
-                chromosomes[0].setDistance(std::numeric_limits<double>::max());
-                chromosomes[1].setDistance(std::numeric_limits<double>::max());
-                continue;
+                // Sort using each objective value
+                for (unsigned int i = 0 ; i < nbSolutions ; i++)
+                    sortedFitness[i] = std::pair< F, unsigned int >(population->getChromosome(front[i]).getFitness()[m], i);
+                std::sort(sortedFitness.begin(), sortedFitness.end());
+
+                // Assigne value of max minus min of fitness for the objective m
+                F maxMinusMinFitness = sortedFitness[nbSolutions-1].first - sortedFitness[0].first;
+
+                if (maxMinusMinFitness == 0) // Little cheat to prevent division by 0
+                    maxMinusMinFitness = 0.00001;
+
+                // So that boundary point are always selected
+                // Extremes chromosomes of the vector are initialized with an infinite distance
+                double* contribution = &contributions[m*nbSolutions];
+                contribution[sortedFitness[0].second] = std::numeric_limits<double>::max();
+                contribution[sortedFitness[nbSolutions-1].second] = std::numeric_limits<double>::max();
+
+                // For all other points
+                for (unsigned int i = 1 ; i < nbSolutions-1 ; i++)
+                {
+                    contribution[sortedFitness[i].second] = (sortedFitness[i+1].first - sortedFitness[i-1].first)
+                                                            / (double)(maxMinusMinFitness);
+                }
             }
+        };
 
-            // So that boundary point are always selected
-            // Extremes chromosomes of the vector are initialized with an infinite distance
-            chromosomes[0].setDistance(std::numeric_limits<double>::max());
-            chromosomes[nbSolutions-1].setDistance(std::numeric_limits<double>::max());
+        if (this->m_threadPool && nbObjective > 1)
+            this->m_threadPool->parallelFor(0, nbObjective, computeContributions);
+        else
+            computeContributions(0, nbObjective);
 
-            // For all other points
-            for (unsigned int i = 1 ; i < nbSolutions-1 ; i++)
+        // Sum contributions in objective order, so that parallel and serial computations give the same distances
+        for (unsigned int i = 0 ; i < nbSolutions ; i++)
+        {
+            double distance = 0;
+            for (unsigned int m = 0 ; m < nbObjective ; m++)
             {
-                double distance =   chromosomes[i].getDistance()
-                                    + (chromosomes[i+1].getFitness()[m] - chromosomes[i-1].getFitness()[m])
-                                    / (maxMinusMinFitness);
-                chromosomes[i].setDistance(distance);
+                if (contributions[m*nbSolutions+i] == std::numeric_limits<double>::max())
+                    distance = std::numeric_limits<double>::max();
+                else
+                    distance += contributions[m*nbSolutions+i];
             }
+            popToAssignCrowdingDistance->getChromosome(front[i]).setDistance(distance);
         }
-
-        // Reaffect chromosomes to the population
-        popToAssignCrowdingDistance->setChromosomes(chromosomes);
-    }
-
-    template<typename F, typename P, typename C>
-    void NSGAII<F, P, C>::addChromosomeWithoutControl(P* pop, C* chromosome)
-    {
-        if (pop->isFull())
-            pop->setNbMaxChromosomes(pop->getNbMaxChromosomes()+1);
-        pop->addChromosome(*chromosome);
     }
 
     template<typename F, typename P, typename C>
@@ -351,13 +355,13 @@ namespace smoga
         this->releaseMemory();
 
         // Generate a random population make step that need to be done before running algorithm
-        this->m_population = new P;
-        this->m_population->generateRandomChromosomes();
+        this->m_population = this->createPopulation();
+        this->m_randomStage = 0;
+        this->m_population->generateRandomChromosomes(this->nextRandomStage());
         this->m_population->evaluateFitness();
 
         // Create offspring of the random population
-        this->m_offspring = breeding();
-        this->m_offspring->evaluateFitness();
+        breeding();
 
         this->m_currentGeneration = 1;
         this->m_isInitialized = true;
@@ -383,6 +387,67 @@ namespace smoga
         this->m_isInitialized = false;
     }
 
+    template<typename F, typename P, typename C>
+    void NSGAII<F, P, C>::logGeneration()
+    {
+        RunLogWriter* log = this->beginLogRecord(true);
+        if (!log)
+            return;
+
+        const std::vector< C >& chromosomes = this->m_population->getChromosomes();
+        const unsigned int nbChromosomes = this->m_population->getCurrentNbChromosomes();
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+        {
+            const int32_t rank = chromosomes[i].getRank();
+            log->write(&rank, sizeof(rank));
+        }
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+        {
+            const double distance = chromosomes[i].getDistance();
+            log->write(&distance, sizeof(distance));
+        }
+
+        log->endGeneration();
+    }
+
+    template<typename F, typename P, typename C>
+    void NSGAII<F, P, C>::writeCheckpoint(CheckpointWriter& checkpoint) const
+    {
+        GA<F, P, C>::writeCheckpoint(checkpoint);
+        this->writePopulation(checkpoint, *m_offspring);
+    }
+
+    template<typename F, typename P, typename C>
+    void NSGAII<F, P, C>::readCheckpoint(CheckpointReader& checkpoint)
+    {
+        GA<F, P, C>::readCheckpoint(checkpoint);
+        m_offspring = this->readPopulation(checkpoint);
+    }
+
+    template<typename F, typename P, typename C>
+    void NSGAII<F, P, C>::writeChromosomeStates(CheckpointWriter& checkpoint, const P& population) const
+    {
+        const std::vector< C >& chromosomes = population.getChromosomes();
+        const unsigned int nbChromosomes = population.getCurrentNbChromosomes();
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+        {
+            checkpoint.writeValue< int32_t >(chromosomes[i].getRank());
+            checkpoint.writeValue< double >(chromosomes[i].getDistance());
+        }
+    }
+
+    template<typename F, typename P, typename C>
+    void NSGAII<F, P, C>::readChromosomeStates(CheckpointReader& checkpoint, P& population) const
+    {
+        const unsigned int nbChromosomes = population.getCurrentNbChromosomes();
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+        {
+            C& chromosome = population.getChromosome(i);
+            chromosome.setRank(checkpoint.readValue< int32_t >());
+            chromosome.setDistance(checkpoint.readValue< double >());
+        }
+    }
+
     template<typename F, typename P, typename C>
     void NSGAII<F, P, C>::dumpToFile(const char* fileName)
     {
@@ -391,14 +456,15 @@ namespace smoga
         if (file)
         {
             std::vector< C > chromosomes = this->m_population->getBestSolution();
-            const unsigned int nbObjectives = this->m_population->getBestSolution()[0].getFitness().empty() ? 0 : this->m_population->getBestSolution()[0].getFitness().size();
-            for (unsigned int i = 0 ; i < this->m_population->getBestSolution().size() ; i++)
+            const unsigned int nbSolutions = chromosomes.size();
+            const unsigned int nbObjectives = chromosomes.empty() ? 0 : chromosomes[0].getFitness().size();
+            for (unsigned int i = 0 ; i < nbSolutions ; i++)
             {
                 file << "N° " << i << " |\tRank : " << chromosomes[i].getRank() << " | Datas : " << chromosomes[i].datasToStr() << " | Fitness : ";
                 for (unsigned int o = 0 ; o < nbObjectives ; o++)
                     file << chromosomes[i].getFitness()[o] << " / ";
-                if (i != this->m_population->getBestSolution().size()-1)
-                    file << std::endl;
+                if (i != nbSolutions-1)
+                    file << '\n';
             }
         }
         else
@@ -3,8 +3,14 @@
 
 #include <vector>
 #include <algorithm>
+#include <utility>
+#include <iterator>
+#include <limits>
 
 #include "General.h"
+#include "threadpool.h"
+#include "fitnesscache.h"
+#include "checkpoint.h"
 
 namespace smoga
 {
@@ -25,6 +31,57 @@ namespace smoga
         static double m_mutateProbability;              ///> Probability for a chromosome to mutate.
 
         std::vector< C > m_chromosomes;                 ///> Chromosomes composing the population.
+        std::vector< C > m_spareChromosomes;            ///> Chromosomes released by recycle(), whose storage is reused by the next chromosomes added.
+
+        ThreadPool* m_threadPool;                       ///> Pool used to compute fitness in parallel, owned by the algorithm (nullptr for a serial computation).
+        FitnessCache< C >* m_fitnessCache;              ///> Cache of the fitness of genomes already evaluated, owned by the algorithm (nullptr without cache).
+
+        /**
+         * @brief computeFitnessOfChromosomes Compute the fitness of all dirty chromosomes, by chunks on m_threadPool when there is one.
+         * C::computeFitness must only modify its own chromosome.
+         */
+        void computeFitnessOfChromosomes();
+
+        /**
+         * @brief evaluateRange Compute the fitness of the dirty chromosomes of [begin, end[ which aren't found in m_fitnessCache,
+         * with one call to computeFitnessBatch.
+         * @param begin Index of the first chromosome.
+         * @param end Index after the last chromosome.
+         */
+        void evaluateRange(const unsigned int begin, const unsigned int end);
+
+        /**
+         * @brief computeFitnessBatch Compute the fitness of a batch of chromosomes, called concurrently on m_threadPool when there is one.
+         * By default C::computeFitness is called on each chromosome. A population whose objectives are vectorized (SIMD, batched model...)
+         * can override it to evaluate the whole batch at once, gathering genes in a matrix with gatherGenes and giving back the fitness matrix with scatterFitness.
+         * The fitness must only depend on the genes, without drawing random numbers.
+         * @param chromosomes Chromosomes to evaluate.
+         * @param nbChromosomes Number of chromosomes.
+         */
+        virtual void computeFitnessBatch(C* const* chromosomes, const unsigned int nbChromosomes) const;
+
+        /**
+         * @brief gatherGenes Copy the genes of chromosomes in a matrix, all chromosomes must have the same number of genes.
+         * @param chromosomes Chromosomes whose genes are copied.
+         * @param nbChromosomes Number of chromosomes.
+         * @param genes Matrix receiving the genes, chromosome i in [i*nbGenes, (i+1)*nbGenes[.
+         * @return Number of genes of each chromosome.
+         */
+        static unsigned int gatherGenes(C* const* chromosomes, const unsigned int nbChromosomes, std::vector< DATA >& genes);
+        /**
+         * @brief scatterFitness Set the fitness of chromosomes from a matrix.
+         * @param fitness Matrix of fitness, chromosome i in [i*nbObjectives, (i+1)*nbObjectives[.
+         * @param nbObjectives Number of objectives.
+         * @param chromosomes Chromosomes whose fitness is set.
+         * @param nbChromosomes Number of chromosomes.
+         */
+        static void scatterFitness(const F* fitness, const unsigned int nbObjectives, C* const* chromosomes, const unsigned int nbChromosomes);
+
+        /**
+         * @brief appendChromosome Append a chromosome at the end of m_chromosomes, taken from the spare chromosomes when there is one.
+         * @return Reference on the appended chromosome, its content is unspecified.
+         */
+        C& appendChromosome();
 
         /**
          * @brief destroy Clear Datas.
@@ -50,12 +107,37 @@ namespace smoga
          * @brief Compute mutation for all chromosomes of the population according to m_mutateProbability.
          */
         virtual void mutate();
+        /**
+         * @brief Compute mutation for all chromosomes of the population according to m_mutateProbability.
+         * Each chromosome draws on its own random stream of the stage, so that chromosomes are mutated in parallel on m_threadPool when there is one.
+         * @param randomStage Stage of the run drawing random numbers.
+         */
+        virtual void mutate(const uint64_t randomStage);
 
         /**
          * @brief selectOneChromosome Select one chromosome from m_chromosomes based on the crowded tournament.
          * @return A chromosome.
          */
         virtual C selectOneChromosome() =0;
+        /**
+         * @brief selectOneIndex Select one chromosome from m_chromosomes like selectOneChromosome, without copying it.
+         * @return Index of the selected chromosome.
+         */
+        virtual unsigned int selectOneIndex() =0;
+
+        /**
+         * @brief prepareMatingPool Called by breed before selecting parents, with the random stream dedicated to the mating pool.
+         * A population can draw all its selections at once here (ex : stochastic universal sampling).
+         * @param nbSelections Number of selections of the breeding, selection numbers are in [0, nbSelections[.
+         */
+        virtual void prepareMatingPool(const unsigned int /*nbSelections*/) {}
+        /**
+         * @brief selectIndex Get the chromosome of a selection of the breeding, an offspring crossed over using 2 consecutive selections and the others one.
+         * By default the chromosome is drawn by selectOneIndex, a population can return the one drawn by prepareMatingPool instead.
+         * @param selection Number of the selection.
+         * @return Index of the selected chromosome.
+         */
+        virtual unsigned int selectIndex(const unsigned int /*selection*/) { return selectOneIndex(); }
 
         /**
          * @brief select a pair of Chromosomes.
@@ -67,18 +149,58 @@ namespace smoga
          * @param parents pair of chromosomes that will be use as parents.
          * @return children Chromosomes generated.
          */
-        virtual C crossOver(const std::pair< C, C > parents) =0;
+        virtual C crossOver(const std::pair< C, C >& parents) =0;
+        /**
+         * @brief crossOver Perform a crossOver on chromosomes, the child being written in offspring to reuse its storage.
+         * By default, the child created by crossOver(parents) is moved into offspring.
+         * @param mum First parent.
+         * @param dad Second parent.
+         * @param offspring Chromosome receiving the child.
+         */
+        virtual void crossOver(const C& mum, const C& dad, C& offspring) { offspring = crossOver(std::pair< C, C >(mum, dad)); }
+
+        /**
+         * @brief prepareSelection Update datas used by the selection after a change of the chromosomes (ex : cumulated fitness), called once all fitness are computed.
+         */
+        virtual void prepareSelection() {}
+        /**
+         * @brief restoreSelection Update datas used by the selection for chromosomes restored in the order prepareSelection left them (ex : from a checkpoint).
+         * By default, it's prepareSelection.
+         */
+        virtual void restoreSelection() { prepareSelection(); }
+
+        /**
+         * @brief breed Fill the free places of the population with offspring of parents.
+         * Each offspring is selected by index, crossed over according to m_crossOverProbability and mutated, then offspring are evaluated by batch,
+         * in place and by chunks on m_threadPool when there is one. The offspring i draws on the random stream i of the stage,
+         * the mating pool of parents on the last stream of the stage.
+         * parents must be ready for selection, and its selection and crossover must be usable by several threads.
+         * @param parents Population in which parents are selected.
+         * @param randomStage Stage of the run drawing random numbers.
+         */
+        virtual void breed(Population& parents, const uint64_t randomStage);
 
         /**
          * @brief generateRandomChromosomes generate a random population of chromosomes.
          */
         virtual void generateRandomChromosomes();
+        /**
+         * @brief generateRandomChromosomes generate a random population of chromosomes, each chromosome drawing on its own random stream of the stage.
+         * @param randomStage Stage of the run drawing random numbers.
+         */
+        virtual void generateRandomChromosomes(const uint64_t randomStage);
 
         /**
          * @brief addChromosome Add a Chromosome to m_chromosomes vector.
          * @param chromosome Will be add to m_chromosomes vector.
          */
         virtual void addChromosome(const C& chromosome);
+        /**
+         * @brief addChromosome Add a Chromosome to m_chromosomes vector without copying it.
+         * It is swapped with a spare chromosome, so chromosome gets back the storage of the spare one.
+         * @param chromosome Will be moved into m_chromosomes vector.
+         */
+        virtual void addChromosome(C&& chromosome);
 
         /**
          * @brief addChromosomes Add a vector of Chromosomes to m_chromosomes vector.
@@ -87,6 +209,11 @@ namespace smoga
          */
         virtual void addChromosomes(const std::vector< C > &chromosomes, int number = -1);
 
+        /**
+         * @brief recycle Empty the population, its chromosomes are kept as spare so that the next chromosomes added reuse their storage.
+         */
+        void recycle();
+
         /**
          * @brief isFull Check if the population is completely filled.
          * @return true if the population is full (m_chromosomes.size() >= m_nbMaxChromosomes).
@@ -119,7 +246,7 @@ namespace smoga
          * @brief getNbMaxChromosomes Get the numbr max of chromosomes for this population.
          * @return Number max of chromosomes for this population.
          */
-        inline int getNbMaxChromosomes() { return this->m_nbMaxChromosomes; }
+        inline int getNbMaxChromosomes() const { return this->m_nbMaxChromosomes; }
 
         /**
          * @brief getCurrentNbChromosomes Get the current number of chromosomes in the population.
@@ -160,16 +287,67 @@ namespace smoga
          */
         static double getProportionalKeeping() { return m_proportionalChromosomesKeep; }
 
+        /**
+         * @brief writeCheckpointParameters Write the parameters of the selection kept in static members of a derived population (nothing by default).
+         * @param checkpoint Checkpoint receiving the parameters.
+         */
+        static void writeCheckpointParameters(CheckpointWriter& /*checkpoint*/) {}
+        /**
+         * @brief readCheckpointParameters Restore the parameters written by writeCheckpointParameters.
+         * @param checkpoint Checkpoint to read.
+         */
+        static void readCheckpointParameters(CheckpointReader& /*checkpoint*/) {}
+
+        /**
+         * @brief setThreadPool Set the pool used to compute fitness in parallel.
+         * @param threadPool Pool to use, the population doesn't take its ownership (nullptr for a serial computation).
+         */
+        inline void setThreadPool(ThreadPool* threadPool) { m_threadPool = threadPool; }
+        /**
+         * @brief getThreadPool Get the pool used to compute fitness in parallel.
+         * @return The pool, nullptr for a serial computation.
+         */
+        inline ThreadPool* getThreadPool() const { return m_threadPool; }
+
+        /**
+         * @brief setFitnessCache Set the cache used to skip the evaluation of genomes already evaluated.
+         * @param fitnessCache Cache to use, the population doesn't take its ownership (nullptr without cache).
+         */
+        inline void setFitnessCache(FitnessCache< C >* fitnessCache) { m_fitnessCache = fitnessCache; }
+        /**
+         * @brief getFitnessCache Get the cache used to skip the evaluation of genomes already evaluated.
+         * @return The cache, nullptr without cache.
+         */
+        inline FitnessCache< C >* getFitnessCache() const { return m_fitnessCache; }
+
+        /**
+         * @brief getChromosome Get the chromosome at the position index in the Population.
+         * @param index Position of the chromosome.
+         * @return Reference on the chromosome.
+         */
+        inline C& getChromosome(const unsigned int index) { return m_chromosomes[index]; }
+        /**
+         * @brief getChromosome Get the chromosome at the position index in the Population.
+         * @param index Position of the chromosome.
+         * @return Constant reference on the chromosome.
+         */
+        inline const C& getChromosome(const unsigned int index) const { return m_chromosomes[index]; }
+
         /**
          * @brief getChromosomes Get the vector storing all chromosomes composing the Population.
-         * @return Vector of chromosomes.
+         * @return Constant reference on the vector of chromosomes.
          */
-        inline std::vector< C > getChromosomes() { return m_chromosomes; }
+        inline const std::vector< C >& getChromosomes() const { return m_chromosomes; }
         /**
          * @brief setChromosomes Set the vector storing all chromosomes composing the Population to those in parameter.
          * @param chromosomes Vector of chromosomes
          */
-        inline void setChromosomes(const std::vector< C > chromosomes) { m_chromosomes = chromosomes; }
+        inline void setChromosomes(const std::vector< C >& chromosomes) { m_chromosomes = chromosomes; }
+        /**
+         * @brief setChromosomes Set the vector storing all chromosomes composing the Population to those in parameter, without copying them.
+         * @param chromosomes Vector of chromosomes, moved into the Population.
+         */
+        inline void setChromosomes(std::vector< C >&& chromosomes) { m_chromosomes = std::move(chromosomes); }
 
         /**
          * @brief getBestSolution Best solution found by GA.
@@ -177,6 +355,13 @@ namespace smoga
          */
         virtual std::vector< C > getBestSolution() const =0;
 
+        /**
+         * @brief merge Move all chromosomes of other at the end of the population, which grows by the size of other.
+         * Chromosomes are swapped with spare ones, so they are neither copied nor evaluated again, and other is left empty.
+         * @param other Population to merge in this one.
+         */
+        void merge(Population& other);
+
         // Operator+ like
         Population& add(const Population& op);
         // Operator
@@ -199,6 +384,9 @@ namespace smoga
     Population<F, DATA, C>::Population(const int maxChromosome)
         : m_nbMaxChromosomes(maxChromosome == -1 ? m_sNbMaxChromosomes : maxChromosome)
         , m_chromosomes()
+        , m_spareChromosomes()
+        , m_threadPool(nullptr)
+        , m_fitnessCache(nullptr)
     {
     }
 
@@ -217,6 +405,7 @@ namespace smoga
     void Population<F, DATA, C>::destroy()
     {
         m_chromosomes.clear();
+        m_spareChromosomes.clear();
     }
 
     template<typename F, typename DATA, typename C>
@@ -224,6 +413,116 @@ namespace smoga
     {
         m_nbMaxChromosomes = other.m_nbMaxChromosomes;
         m_chromosomes = other.m_chromosomes;
+        m_threadPool = other.m_threadPool;
+        m_fitnessCache = other.m_fitnessCache;
+    }
+
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::computeFitnessOfChromosomes()
+    {
+        const unsigned int nbChromosomes = m_chromosomes.size();
+        if (!m_threadPool)
+        {
+            evaluateRange(0, nbChromosomes);
+            return;
+        }
+
+        m_threadPool->parallelFor(0, nbChromosomes, [this](const unsigned int begin, const unsigned int end)
+        {
+            this->evaluateRange(begin, end);
+        });
+    }
+
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::evaluateRange(const unsigned int begin, const unsigned int end)
+    {
+        // Batch of the chromosomes to compute, kept by each thread to reuse its memory
+        static thread_local std::vector< C* > batch;
+        batch.clear();
+
+        for (unsigned int i = begin ; i < end ; ++i)
+        {
+            C& chromosome = m_chromosomes[i];
+
+            // A chromosome copied or not mutated since its last evaluation keeps its fitness
+            if (!chromosome.isDirty())
+                continue;
+
+            if (m_fitnessCache && m_fitnessCache->find(chromosome))
+                chromosome.setDirty(false);
+            else
+                batch.push_back(&chromosome);
+        }
+
+        if (batch.empty())
+            return;
+
+        computeFitnessBatch(batch.data(), batch.size());
+
+        for (unsigned int i = 0 ; i < batch.size() ; ++i)
+        {
+            if (m_fitnessCache)
+                m_fitnessCache->insert(*batch[i]);
+            batch[i]->setDirty(false);
+        }
+    }
+
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::computeFitnessBatch(C* const* chromosomes, const unsigned int nbChromosomes) const
+    {
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+            chromosomes[i]->computeFitness();
+    }
+
+    template<typename F, typename DATA, typename C>
+    unsigned int Population<F, DATA, C>::gatherGenes(C* const* chromosomes, const unsigned int nbChromosomes, std::vector< DATA >& genes)
+    {
+        genes.clear();
+        if (nbChromosomes == 0)
+            return 0;
+
+        const unsigned int nbGenes = chromosomes[0]->getDatas().size();
+        genes.reserve(nbChromosomes * nbGenes);
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+        {
+            const auto& datas = chromosomes[i]->getDatas();
+            if (datas.size() != nbGenes)
+                throw std::runtime_error("Chromosomes of a batch must have the same number of genes!");
+            genes.insert(genes.end(), datas.begin(), datas.end());
+        }
+        return nbGenes;
+    }
+
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::scatterFitness(const F* fitness, const unsigned int nbObjectives, C* const* chromosomes, const unsigned int nbChromosomes)
+    {
+        for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+            chromosomes[i]->setFitness(fitness + i*nbObjectives, nbObjectives);
+    }
+
+    template<typename F, typename DATA, typename C>
+    C& Population<F, DATA, C>::appendChromosome()
+    {
+        if (m_spareChromosomes.empty())
+            m_chromosomes.emplace_back();
+        else
+        {
+            m_chromosomes.push_back(std::move(m_spareChromosomes.back()));
+            m_spareChromosomes.pop_back();
+        }
+        return m_chromosomes.back();
+    }
+
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::recycle()
+    {
+        if (m_spareChromosomes.empty())
+            m_spareChromosomes.swap(m_chromosomes);
+        else
+        {
+            m_spareChromosomes.insert(m_spareChromosomes.end(), std::make_move_iterator(m_chromosomes.begin()), std::make_move_iterator(m_chromosomes.end()));
+            m_chromosomes.clear();
+        }
     }
 
     template<typename F, typename DATA, typename C>
@@ -231,7 +530,98 @@ namespace smoga
     {
         const unsigned int nbChromosomes = m_chromosomes.size();
         for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
-            m_chromosomes[i].mutate();
+            if (m_chromosomes[i].mutate())
+                m_chromosomes[i].setDirty(true);
+    }
+
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::mutate(const uint64_t randomStage)
+    {
+        const unsigned int nbChromosomes = m_chromosomes.size();
+        if (!m_threadPool)
+        {
+            for (unsigned int i = 0 ; i < nbChromosomes ; ++i)
+            {
+                selectRandomStream(randomStage, i);
+                if (m_chromosomes[i].mutate())
+                    m_chromosomes[i].setDirty(true);
+            }
+            return;
+        }
+
+        m_threadPool->parallelFor(0, nbChromosomes, [this, randomStage](const unsigned int begin, const unsigned int end)
+        {
+            for (unsigned int i = begin ; i < end ; ++i)
+            {
+                selectRandomStream(randomStage, i);
+                if (this->m_chromosomes[i].mutate())
+                    this->m_chromosomes[i].setDirty(true);
+            }
+        });
+    }
+
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::breed(Population<F, DATA, C>& parents, const uint64_t randomStage)
+    {
+        const unsigned int nbKept = m_chromosomes.size();
+        if (nbKept >= m_nbMaxChromosomes)
+            return;
+
+        // Offspring are written directly in their final place, reusing spare chromosomes
+        m_chromosomes.reserve(m_nbMaxChromosomes);
+        while (m_chromosomes.size() < m_nbMaxChromosomes)
+            appendChromosome();
+
+        // Crossover is decided before drawing the mating pool, so that the pool has exactly one selection per parent used :
+        // two for an offspring crossed over, one otherwise. The decision is the first draw of the stream of each offspring
+        const unsigned int nbOffspring = m_nbMaxChromosomes - nbKept;
+        const double crossOverProbability = m_crossOverProbability;
+        std::vector< unsigned int > firstSelections(nbOffspring+1, 0);   // Selections of the offspring k are [firstSelections[k], firstSelections[k+1][
+        {
+            std::uniform_real_distribution<float> distribution(0.0, 1.0);
+            for (unsigned int k = 0 ; k < nbOffspring ; ++k)
+            {
+                selectRandomStream(randomStage, k);
+                firstSelections[k+1] = firstSelections[k] + (distribution(generator) <= crossOverProbability ? 2 : 1);
+            }
+        }
+
+        // Parents may draw their mating pool at once
+        selectRandomStream(randomStage, std::numeric_limits< uint32_t >::max());
+        parents.prepareMatingPool(firstSelections[nbOffspring]);
+
+        std::function<void(unsigned int, unsigned int)> breedRange = [this, &parents, &firstSelections, nbKept, randomStage, crossOverProbability](const unsigned int begin, const unsigned int end)
+        {
+            std::uniform_real_distribution<float> distribution(0.0, 1.0);
+            for (unsigned int i = begin ; i < end ; ++i)
+            {
+                const unsigned int k = i - nbKept;
+                selectRandomStream(randomStage, k);
+
+                // Parents are selected by index, so that they are never copied
+                C& offspring = this->m_chromosomes[i];
+                if (distribution(generator) <= crossOverProbability) // Crossover, same draw as the decision before the mating pool
+                {
+                    const C& mum = parents.getChromosome(parents.selectIndex(firstSelections[k]));
+                    const C& dad = parents.getChromosome(parents.selectIndex(firstSelections[k]+1));
+                    parents.crossOver(mum, dad, offspring);
+                    offspring.setDirty(true);
+                }
+                else    // Don't Crossover
+                    offspring = parents.getChromosome(parents.selectIndex(firstSelections[k]));
+
+                if (offspring.mutate())
+                    offspring.setDirty(true);
+            }
+
+            // Offspring of the chunk are evaluated at once
+            this->evaluateRange(begin, end);
+        };
+
+        if (m_threadPool)
+            m_threadPool->parallelFor(nbKept, m_nbMaxChromosomes, breedRange);
+        else
+            breedRange(nbKept, m_nbMaxChromosomes);
     }
 
     template<typename F, typename DATA, typename C>
@@ -243,7 +633,22 @@ namespace smoga
         {
             C chromosome;
             chromosome.generateRandomChromosome();
-            addChromosome(chromosome);
+            addChromosome(std::move(chromosome));
+        }
+    }
+
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::generateRandomChromosomes(const uint64_t randomStage)
+    {
+        m_chromosomes.clear();
+        // Fill the population until it is full
+        unsigned int index = 0;
+        while (!isFull())
+        {
+            selectRandomStream(randomStage, index++);
+            C chromosome;
+            chromosome.generateRandomChromosome();
+            addChromosome(std::move(chromosome));
         }
     }
 
@@ -251,7 +656,14 @@ namespace smoga
     void Population<F, DATA, C>::addChromosome(const C &chromosome)
     {
         if (!isFull())
-            m_chromosomes.push_back(chromosome);
+            appendChromosome() = chromosome;
+    }
+
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::addChromosome(C&& chromosome)
+    {
+        if (!isFull())
+            std::swap(appendChromosome(), chromosome);
     }
 
     template<typename F, typename DATA, typename C>
@@ -261,7 +673,7 @@ namespace smoga
         int i = 0;
         while (!isFull() && i < limit)
         {
-            m_chromosomes.push_back(chromosomes[i]);
+            appendChromosome() = chromosomes[i];
             ++i;
         }
     }
@@ -281,11 +693,26 @@ namespace smoga
         m_nbMaxChromosomes = m_sNbMaxChromosomes;
     }
 
+    template<typename F, typename DATA, typename C>
+    void Population<F, DATA, C>::merge(Population<F, DATA, C>& other)
+    {
+        const unsigned int nbOtherChromosomes = other.m_chromosomes.size();
+        this->m_chromosomes.reserve(this->m_chromosomes.size() + nbOtherChromosomes);
+        for (unsigned int i = 0 ; i < nbOtherChromosomes ; ++i)
+            std::swap(appendChromosome(), other.m_chromosomes[i]);
+        this->m_nbMaxChromosomes += other.m_nbMaxChromosomes;
+
+        // other gets the storage of the spare chromosomes as its own spare chromosomes
+        other.recycle();
+        prepareSelection();
+    }
+
     template<typename F, typename DATA, typename C>
     Population<F, DATA, C>& Population<F, DATA, C>::add(const Population<F, DATA, C>& op)
     {
         this->m_chromosomes.reserve(this->m_chromosomes.size() + op.m_chromosomes.size());
-        this->m_chromosomes.insert(this->m_chromosomes.end(), op.m_chromosomes.begin(), op.m_chromosomes.end());
+        for (unsigned int i = 0 ; i < op.m_chromosomes.size() ; ++i)
+            appendChromosome() = op.m_chromosomes[i];
         this->m_nbMaxChromosomes += op.m_nbMaxChromosomes;
 
         return *this;
@@ -0,0 +1,89 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+namespace smoga
+{
+
+    /**
+     * @brief The Philox4x32 class Counter-based random number generator Philox4x32-10 of Salmon et al.
+     * A stream is identified by the seed of the run, a stage and an index, so that any work item can draw
+     * its own numbers without depending on the thread running it or on the order of the other items.
+     * It satisfies the requirements of UniformRandomBitGenerator and can be used with std distributions.
+     */
+    class Philox4x32
+    {
+    public:
+        typedef uint32_t result_type;
+
+    protected:
+        uint32_t m_key[2];      ///> Key of the stream, derived from the seed of the run.
+        uint32_t m_counter[4];  ///> Counter of the next block : block index, item index and stage.
+        uint32_t m_block[4];    ///> Last block of random numbers generated.
+        unsigned int m_position;///> Position of the next number to return in m_block.
+
+        /**
+         * @brief generateBlock Encrypt m_counter with m_key to fill m_block, then increment the block index.
+         */
+        void generateBlock();
+
+    public:
+        /**
+         * @brief Philox4x32 Create a generator on the stream (seed, stage, index).
+         * @param seed Seed of the run.
+         * @param stage Stage of the run drawing on the stream (generation, step, etc...).
+         * @param index Index of the work item in the stage.
+         */
+        Philox4x32(const uint64_t seed = 686452231, const uint64_t stage = UINT64_MAX, const uint32_t index = 0);
+
+        /**
+         * @brief seed Move the generator at the beginning of the stream (seed, stage, index).
+         * @param seed Seed of the run.
+         * @param stage Stage of the run drawing on the stream.
+         * @param index Index of the work item in the stage.
+         */
+        void seed(const uint64_t seed, const uint64_t stage, const uint32_t index);
+
+        /**
+         * @brief operator() Draw the next number of the stream.
+         * @return Uniform random number in [min(), max()].
+         */
+        inline result_type operator()()
+        {
+            if (m_position == 4)
+                generateBlock();
+            return m_block[m_position++];
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return UINT32_MAX; }
+    };
+
+    /**
+     * @brief setRandomSeed Set the seed of the run, from which all random streams are derived.
+     * The stream of the calling thread is reset on the new seed.
+     * @param seed Seed of the run.
+     */
+    void setRandomSeed(const uint64_t seed);
+    /**
+     * @brief getRandomSeed Get the seed of the run.
+     * @return Seed of the run.
+     */
+    uint64_t getRandomSeed();
+
+    /**
+     * @brief selectRandomStream Make the generator of the calling thread draw on the stream (seed of the run, stage, index).
+     * Work items run in parallel select their own stream, so that results are identical whatever the number of threads.
+     * @param stage Stage of the run drawing on the stream.
+     * @param index Index of the work item in the stage.
+     */
+    void selectRandomStream(const uint64_t stage, const uint32_t index);
+
+}
+
+// Random number generator of the calling thread
+// Other possible seed : std::chrono::system_clock::now().time_since_epoch().count() with smoga::setRandomSeed
+extern thread_local smoga::Philox4x32 generator;
+
+#endif // RANDOM_H
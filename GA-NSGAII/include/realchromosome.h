@@ -0,0 +1,360 @@
+#ifndef REALCHROMOSOME_H
+#define REALCHROMOSOME_H
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+#include "General.h"
+#include "chromosome.h"
+
+namespace smoga
+{
+
+    template<typename F>
+    /**
+     * @brief The RealChromosome class Provide a real-coded chromosome, its genes are the variables of the problem (no decoding).
+     * Gene i stays in [getLowerBound(i), getUpperBound(i)].
+     * Crossover is the bounded simulated binary crossover (SBX) and mutation the bounded polynomial mutation of Deb.
+     * SBX draws all its random numbers before its loop on genes, so that this loop only computes on contiguous doubles.
+     * computeFitness is left to the problem.
+     */
+    class RealChromosome
+            : public Chromosome<F, double>
+    {
+    protected:
+        static std::vector< double > m_lowerBounds;     ///> Lower bound of each gene.
+        static std::vector< double > m_upperBounds;     ///> Upper bound of each gene.
+        static double m_crossOverDistributionIndex;     ///> Distribution index of SBX (large values give children close to their parents).
+        static double m_mutationDistributionIndex;      ///> Distribution index of the polynomial mutation.
+        static double m_geneCrossOverProbability;       ///> Probability for each gene to be crossed over by SBX.
+        static double m_mutateProbability;              ///> Probability for each gene to be mutated (1/m_nbGenes if negative).
+
+        /**
+         * @brief randoms Get the random numbers buffer of the thread, reused by all crossovers.
+         * @param size Number of random numbers needed.
+         * @return Buffer of at least size numbers.
+         */
+        static std::vector< double >& randoms(const unsigned int size)
+        {
+            static thread_local std::vector< double > buffer;
+            if (buffer.size() < size)
+                buffer.resize(size);
+            return buffer;
+        }
+
+    public:
+        RealChromosome();
+
+        /**
+         * @brief mutate Apply the polynomial mutation to each gene with the probability getMutateProbability(),
+         * by jumping from a mutated gene to the next one with a geometric distribution.
+         * @return true if at least one gene has been mutated.
+         */
+        virtual bool mutate();
+
+        /**
+         * @brief generateRandomChromosome Generate genes uniformly in their bounds.
+         */
+        virtual void generateRandomChromosome();
+
+        /**
+         * @brief crossOver Set the genes of the chromosome to one of the 2 children of the SBX of mum and dad, chosen for each gene.
+         * Each gene is crossed over with the probability m_geneCrossOverProbability, otherwise it's taken from mum or dad.
+         * @param mum First parent.
+         * @param dad Second parent.
+         */
+        void crossOver(const RealChromosome& mum, const RealChromosome& dad);
+
+        virtual std::string datasToStr();
+
+        ////////////// Accessor/Setters //////////////
+        /**
+         * @brief setBounds Set the same bounds to all genes.
+         * @param lowerBound Lower bound of the genes.
+         * @param upperBound Upper bound of the genes.
+         */
+        static void setBounds(const double lowerBound, const double upperBound);
+        /**
+         * @brief setBounds Set the bounds of each gene, the number of genes becoming the number of bounds.
+         * @param lowerBounds Lower bound of each gene.
+         * @param upperBounds Upper bound of each gene.
+         */
+        static void setBounds(const std::vector< double >& lowerBounds, const std::vector< double >& upperBounds);
+        /**
+         * @brief getLowerBound Get the lower bound of a gene.
+         * @param index Index of the gene.
+         * @return Lower bound.
+         */
+        static inline double getLowerBound(const unsigned int index) { return m_lowerBounds.size() == 1 ? m_lowerBounds[0] : m_lowerBounds[index]; }
+        /**
+         * @brief getUpperBound Get the upper bound of a gene.
+         * @param index Index of the gene.
+         * @return Upper bound.
+         */
+        static inline double getUpperBound(const unsigned int index) { return m_upperBounds.size() == 1 ? m_upperBounds[0] : m_upperBounds[index]; }
+
+        /**
+         * @brief setCrossOverDistributionIndex Set the distribution index of SBX.
+         * @param distributionIndex Distribution index (usually between 2 and 20).
+         */
+        static void setCrossOverDistributionIndex(const double distributionIndex) { m_crossOverDistributionIndex = distributionIndex; }
+        /**
+         * @brief getCrossOverDistributionIndex Get the distribution index of SBX.
+         * @return Distribution index.
+         */
+        static double getCrossOverDistributionIndex() { return m_crossOverDistributionIndex; }
+        /**
+         * @brief setMutationDistributionIndex Set the distribution index of the polynomial mutation.
+         * @param distributionIndex Distribution index (usually between 20 and 100).
+         */
+        static void setMutationDistributionIndex(const double distributionIndex) { m_mutationDistributionIndex = distributionIndex; }
+        /**
+         * @brief getMutationDistributionIndex Get the distribution index of the polynomial mutation.
+         * @return Distribution index.
+         */
+        static double getMutationDistributionIndex() { return m_mutationDistributionIndex; }
+        /**
+         * @brief setGeneCrossOverProbability Set the probability for each gene to be crossed over by SBX.
+         * @param geneCrossOverProbability Probability for each gene.
+         */
+        static void setGeneCrossOverProbability(const double geneCrossOverProbability) { m_geneCrossOverProbability = geneCrossOverProbability; }
+        /**
+         * @brief getGeneCrossOverProbability Get the probability for each gene to be crossed over by SBX.
+         * @return Probability for each gene.
+         */
+        static double getGeneCrossOverProbability() { return m_geneCrossOverProbability; }
+        /**
+         * @brief setMutateProbability Set the probability for each gene to be mutated.
+         * @param mutateProbability Probability for each gene, a negative value to use 1/m_nbGenes.
+         */
+        static void setMutateProbability(const double mutateProbability) { m_mutateProbability = mutateProbability; }
+        /**
+         * @brief getMutateProbability Get the probability for each gene to be mutated.
+         * @return Probability for each gene.
+         */
+        static double getMutateProbability()
+        {
+            if (m_mutateProbability >= 0)
+                return m_mutateProbability;
+            return Chromosome<F, double>::m_nbGenes == 0 ? 0 : 1.0 / Chromosome<F, double>::m_nbGenes;
+        }
+
+        /**
+         * @brief writeCheckpointParameters Write the bounds, the distribution indexes and the probabilities of the genes.
+         * @param checkpoint Checkpoint receiving the parameters.
+         */
+        static void writeCheckpointParameters(CheckpointWriter& checkpoint);
+        /**
+         * @brief readCheckpointParameters Restore the parameters written by writeCheckpointParameters.
+         * @param checkpoint Checkpoint to read.
+         */
+        static void readCheckpointParameters(CheckpointReader& checkpoint);
+    };
+
+    template<typename F>
+    std::vector< double > RealChromosome<F>::m_lowerBounds(1, 0.0);
+
+    template<typename F>
+    std::vector< double > RealChromosome<F>::m_upperBounds(1, 1.0);
+
+    template<typename F>
+    double RealChromosome<F>::m_crossOverDistributionIndex = 15;
+
+    template<typename F>
+    double RealChromosome<F>::m_mutationDistributionIndex = 20;
+
+    template<typename F>
+    double RealChromosome<F>::m_geneCrossOverProbability = 0.5;
+
+    template<typename F>
+    double RealChromosome<F>::m_mutateProbability = -1;
+
+    template<typename F>
+    RealChromosome<F>::RealChromosome()
+        : Chromosome<F, double>()
+    {
+    }
+
+    template<typename F>
+    bool RealChromosome<F>::mutate()
+    {
+        const double proba = getMutateProbability();
+        const unsigned int nbGenes = std::min< unsigned int >(this->m_nbGenes, this->m_datas.size());
+        if (proba <= 0 || nbGenes == 0)
+            return false;
+
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        const double mutationPower = 1.0 / (m_mutationDistributionIndex + 1);
+        bool flag = false;
+
+        // Number of genes skipped before the next mutated gene
+        const bool allGenes = proba >= 1;
+        std::geometric_distribution<unsigned int> distributionSkip(allGenes ? 0.5 : proba);
+        auto skip = [&]() { return allGenes ? 0u : distributionSkip(generator); };
+        for (unsigned int i = skip() ; i < nbGenes ; i += 1 + skip())
+        {
+            const double lowerBound = getLowerBound(i);
+            const double upperBound = getUpperBound(i);
+            const double range = upperBound - lowerBound;
+            if (range <= 0)
+                continue;
+
+            const double gene = this->m_datas[i];
+            const double random = distribution(generator);
+            double deltaq;
+            if (random < 0.5)
+            {
+                const double xy = 1 - (gene - lowerBound) / range;
+                const double value = 2*random + (1 - 2*random) * std::pow(xy, m_mutationDistributionIndex + 1);
+                deltaq = std::pow(value, mutationPower) - 1;
+            }
+            else
+            {
+                const double xy = 1 - (upperBound - gene) / range;
+                const double value = 2*(1 - random) + 2*(random - 0.5) * std::pow(xy, m_mutationDistributionIndex + 1);
+                deltaq = 1 - std::pow(value, mutationPower);
+            }
+
+            this->m_datas[i] = std::min(std::max(gene + deltaq * range, lowerBound), upperBound);
+            flag = true;
+        }
+
+        return flag;
+    }
+
+    template<typename F>
+    void RealChromosome<F>::generateRandomChromosome()
+    {
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+        const unsigned int nbGenes = this->m_nbGenes;
+        this->m_datas.resize(nbGenes);
+        for (unsigned int i = 0 ; i < nbGenes ; ++i)
+            this->m_datas[i] = getLowerBound(i) + distribution(generator) * (getUpperBound(i) - getLowerBound(i));
+    }
+
+    template<typename F>
+    void RealChromosome<F>::crossOver(const RealChromosome<F>& mum, const RealChromosome<F>& dad)
+    {
+        this->m_isDirty = true;
+
+        const unsigned int nbGenes = this->m_nbGenes;
+        if (nbGenes == 0)
+        {
+            this->m_datas.clear();
+            return;
+        }
+
+        // 3 random numbers by gene : crossed over or not, spread of the children, child kept
+        std::uniform_real_distribution<double> distribution(0.0, 1.0);
+        std::vector< double >& random = randoms(3*nbGenes);
+        for (unsigned int i = 0 ; i < 3*nbGenes ; ++i)
+            random[i] = distribution(generator);
+
+        const double* mumGenes = mum.m_datas.data();
+        const double* dadGenes = dad.m_datas.data();
+        this->m_datas.resize(nbGenes);
+        double* genes = this->m_datas.data();
+
+        const double crossOverPower = 1.0 / (m_crossOverDistributionIndex + 1);
+        for (unsigned int i = 0 ; i < nbGenes ; ++i)
+        {
+            const bool keepFirst = random[3*i + 2] <= 0.5;
+            const double y1 = std::min(mumGenes[i], dadGenes[i]);
+            const double y2 = std::max(mumGenes[i], dadGenes[i]);
+            const double distance = y2 - y1;
+
+            // Gene not crossed over, or parents too close to spread children
+            if (random[3*i] > m_geneCrossOverProbability || distance <= 1e-14)
+            {
+                genes[i] = keepFirst ? mumGenes[i] : dadGenes[i];
+                continue;
+            }
+
+            const double lowerBound = getLowerBound(i);
+            const double upperBound = getUpperBound(i);
+            const double u = random[3*i + 1];
+
+            // Spread factor of each child, bounded so that it stays in [lowerBound, upperBound]
+            const double beta1 = 1 + 2 * (y1 - lowerBound) / distance;
+            const double alpha1 = 2 - std::pow(beta1, -(m_crossOverDistributionIndex + 1));
+            const double betaq1 = u <= 1 / alpha1 ? std::pow(u * alpha1, crossOverPower) : std::pow(1 / (2 - u * alpha1), crossOverPower);
+
+            const double beta2 = 1 + 2 * (upperBound - y2) / distance;
+            const double alpha2 = 2 - std::pow(beta2, -(m_crossOverDistributionIndex + 1));
+            const double betaq2 = u <= 1 / alpha2 ? std::pow(u * alpha2, crossOverPower) : std::pow(1 / (2 - u * alpha2), crossOverPower);
+
+            const double child1 = std::min(std::max(0.5 * ((y1 + y2) - betaq1 * distance), lowerBound), upperBound);
+            const double child2 = std::min(std::max(0.5 * ((y1 + y2) + betaq2 * distance), lowerBound), upperBound);
+            genes[i] = keepFirst ? child1 : child2;
+        }
+    }
+
+    template<typename F>
+    std::string RealChromosome<F>::datasToStr()
+    {
+        std::ostringstream datasStr;
+        for (unsigned int i = 0 ; i < this->m_datas.size() ; i++)
+        {
+            if (i != 0)
+                datasStr << ' ';
+            datasStr << this->m_datas[i];
+        }
+        return datasStr.str();
+    }
+
+    template<typename F>
+    void RealChromosome<F>::setBounds(const double lowerBound, const double upperBound)
+    {
+        if (lowerBound > upperBound)
+            throw std::runtime_error("Lower bound of genes must not be greater than their upper bound!");
+
+        m_lowerBounds.assign(1, lowerBound);
+        m_upperBounds.assign(1, upperBound);
+    }
+
+    template<typename F>
+    void RealChromosome<F>::setBounds(const std::vector< double >& lowerBounds, const std::vector< double >& upperBounds)
+    {
+        if (lowerBounds.empty() || lowerBounds.size() != upperBounds.size())
+            throw std::runtime_error("Each gene must have a lower and an upper bound!");
+        for (unsigned int i = 0 ; i < lowerBounds.size() ; ++i)
+            if (lowerBounds[i] > upperBounds[i])
+                throw std::runtime_error("Lower bound of genes must not be greater than their upper bound!");
+
+        m_lowerBounds = lowerBounds;
+        m_upperBounds = upperBounds;
+        Chromosome<F, double>::setNbGenes(lowerBounds.size());
+    }
+
+    template<typename F>
+    void RealChromosome<F>::writeCheckpointParameters(CheckpointWriter& checkpoint)
+    {
+        checkpoint.writeValue< uint32_t >(m_lowerBounds.size());
+        checkpoint.write(m_lowerBounds.data(), m_lowerBounds.size() * sizeof(double));
+        checkpoint.write(m_upperBounds.data(), m_upperBounds.size() * sizeof(double));
+        checkpoint.writeValue< double >(m_crossOverDistributionIndex);
+        checkpoint.writeValue< double >(m_mutationDistributionIndex);
+        checkpoint.writeValue< double >(m_geneCrossOverProbability);
+        checkpoint.writeValue< double >(m_mutateProbability);
+    }
+
+    template<typename F>
+    void RealChromosome<F>::readCheckpointParameters(CheckpointReader& checkpoint)
+    {
+        // Bounds are restored as they were set, without changing the number of genes read before
+        const uint32_t nbBounds = checkpoint.readValue< uint32_t >();
+        m_lowerBounds.resize(nbBounds);
+        m_upperBounds.resize(nbBounds);
+        checkpoint.read(m_lowerBounds.data(), nbBounds * sizeof(double));
+        checkpoint.read(m_upperBounds.data(), nbBounds * sizeof(double));
+        m_crossOverDistributionIndex = checkpoint.readValue< double >();
+        m_mutationDistributionIndex = checkpoint.readValue< double >();
+        m_geneCrossOverProbability = checkpoint.readValue< double >();
+        m_mutateProbability = checkpoint.readValue< double >();
+    }
+
+}
+
+#endif // REALCHROMOSOME_H
@@ -0,0 +1,190 @@
+#ifndef RUNHISTORY_H
+#define RUNHISTORY_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "runlog.h"
+
+namespace smoga
+{
+
+    /**
+     * @brief The RunHistoryGeneration class Columns of a generation of a RunHistory, pointing in the mapped file without copy.
+     * Values aren't aligned in the file, so they are read by copy (accessors) rather than by pointer.
+     * A generation is valid until the history is refreshed or destroyed.
+     */
+    class RunHistoryGeneration
+    {
+    public:
+        const RunLogHeader* header;     ///> Header of the run log.
+        uint32_t generation;            ///> Index of the generation.
+        uint32_t nbChromosomes;         ///> Number of chromosomes of the generation.
+        const char* genes;              ///> Genes of all chromosomes.
+        const char* fitness;            ///> Fitness of all chromosomes.
+        const char* ranks;              ///> Rank (int32_t) of each chromosome, nullptr without ranks.
+        const char* distances;          ///> Crowding distance (double) of each chromosome, nullptr without ranks.
+
+        template<typename T>
+        /**
+         * @brief getGene Get a gene of a chromosome, T must be the type of the genes.
+         * @param chromosome Index of the chromosome.
+         * @param gene Index of the gene.
+         * @return The gene.
+         */
+        inline T getGene(const unsigned int chromosome, const unsigned int gene) const
+        {
+            if (sizeof(T) != header->geneSize)
+                throw std::runtime_error("Type of genes doesn't match the run log!");
+            T value;
+            std::memcpy(&value, genes + (std::size_t(chromosome) * header->nbGenes + gene) * sizeof(T), sizeof(T));
+            return value;
+        }
+
+        /**
+         * @brief getFitness Get a fitness value converted in double.
+         * @param chromosome Index of the chromosome.
+         * @param objective Index of the objective.
+         * @return Fitness value.
+         */
+        inline double getFitness(const unsigned int chromosome, const unsigned int objective) const
+        {
+            const std::size_t index = std::size_t(chromosome) * header->nbObjectives + objective;
+            return readRunLogValue(fitness + index * header->fitnessSize, header->fitnessType);
+        }
+
+        /**
+         * @brief getRank Get the rank of a chromosome (the run log must have ranks).
+         * @param chromosome Index of the chromosome.
+         * @return Rank of the chromosome.
+         */
+        inline int32_t getRank(const unsigned int chromosome) const
+        {
+            int32_t rank;
+            std::memcpy(&rank, ranks + chromosome * sizeof(int32_t), sizeof(int32_t));
+            return rank;
+        }
+
+        /**
+         * @brief getDistance Get the crowding distance of a chromosome (the run log must have ranks).
+         * @param chromosome Index of the chromosome.
+         * @return Crowding distance of the chromosome.
+         */
+        inline double getDistance(const unsigned int chromosome) const
+        {
+            double distance;
+            std::memcpy(&distance, distances + chromosome * sizeof(double), sizeof(double));
+            return distance;
+        }
+    };
+
+    /**
+     * @brief The RunHistory class Random access to the generations of a run log, mapped in memory.
+     * Offsets of the records are indexed once when the file is opened (only record headers are read),
+     * then any generation is found in O(1) and its columns are read in place, without parsing nor copy.
+     * The history can be refreshed while the run log is still written, only the new records are indexed.
+     */
+    class RunHistory
+    {
+    protected:
+        std::string m_fileName;                     ///> Name of the run log.
+        const char* m_datas;                        ///> Mapped file, nullptr if nothing is mapped.
+        std::size_t m_size;                         ///> Size of the mapped file in bytes.
+        RunLogHeader m_header;                      ///> Header of the run log.
+        std::vector< uint64_t > m_recordOffsets;    ///> Offset of each complete record in the file, in order.
+        std::vector< int32_t > m_recordOfGeneration;///> Index of the record of each generation, -1 if it isn't logged.
+        uint64_t m_indexedEnd;                      ///> Offset of the end of the last indexed record in the file.
+
+        /**
+         * @brief map Map the whole file in memory, replacing the previous mapping.
+         */
+        void map();
+
+        /**
+         * @brief unmap Release the mapping of the file.
+         */
+        void unmap();
+
+        /**
+         * @brief readHeader Read and check the header of the mapped file, the file is unmapped if it isn't a run log.
+         */
+        void readHeader();
+
+        /**
+         * @brief clearIndex Forget the indexed records, the next indexRecords starts after the header.
+         */
+        void clearIndex();
+
+        /**
+         * @brief indexRecords Index the complete records after the last indexed one.
+         */
+        void indexRecords();
+
+    public:
+        /**
+         * @brief RunHistory Map a run log and index its generations.
+         * @param fileName Name of the file.
+         */
+        RunHistory(const std::string& fileName);
+        RunHistory(const RunHistory& other) = delete;
+        virtual ~RunHistory();
+
+        RunHistory& operator=(const RunHistory& other) = delete;
+
+        /**
+         * @brief refresh Map the file again, so that the records written since (run log still written) are indexed.
+         * If the run log has been truncated or rewritten since, its header is read again and all its records are indexed again.
+         * Generations got before are invalidated.
+         * @return true if new records have been indexed.
+         */
+        bool refresh();
+
+        /**
+         * @brief getRecordIndex Find the record of a generation.
+         * @param generation Index of the generation.
+         * @return Index of the record, -1 if the generation isn't in the run log.
+         */
+        inline int getRecordIndex(const uint32_t generation) const
+        {
+            return generation < m_recordOfGeneration.size() ? m_recordOfGeneration[generation] : -1;
+        }
+
+        /**
+         * @brief getRecord Get the columns of a record.
+         * @param record Index of the record, lower than getNbRecords.
+         * @return The generation of the record.
+         */
+        RunHistoryGeneration getRecord(const unsigned int record) const;
+
+        /**
+         * @brief getGeneration Get the columns of a generation.
+         * @param generation Index of the generation.
+         * @param datas Columns of the generation.
+         * @return false if the generation isn't in the run log.
+         */
+        bool getGeneration(const uint32_t generation, RunHistoryGeneration& datas) const;
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getHeader Get the header of the run log.
+         * @return The header.
+         */
+        inline const RunLogHeader& getHeader() const { return m_header; }
+        /**
+         * @brief getFileName Get the name of the run log.
+         * @return Name of the file.
+         */
+        inline const std::string& getFileName() const { return m_fileName; }
+        /**
+         * @brief getNbRecords Get the number of generations in the run log.
+         * @return Number of records.
+         */
+        inline unsigned int getNbRecords() const { return m_recordOffsets.size(); }
+    };
+
+}
+
+#endif // RUNHISTORY_H
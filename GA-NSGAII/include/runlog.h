@@ -0,0 +1,261 @@
+#ifndef RUNLOG_H
+#define RUNLOG_H
+
+#include <vector>
+#include <string>
+#include <fstream>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace smoga
+{
+
+    /**
+     * @brief The RunLogValueType enum Type of the values of a column of a run log, so that a reader can convert them.
+     */
+    enum RunLogValueType
+    {
+        RUNLOG_RAW = 0,     ///> Values only known by their size.
+        RUNLOG_INT32,       ///> int32_t values.
+        RUNLOG_UINT32,      ///> uint32_t values.
+        RUNLOG_INT64,       ///> int64_t values.
+        RUNLOG_UINT64,      ///> uint64_t values.
+        RUNLOG_FLOAT,       ///> float values.
+        RUNLOG_DOUBLE       ///> double values.
+    };
+
+    template<typename T>
+    /**
+     * @brief The RunLogValue struct Give the RunLogValueType of a C++ type (RUNLOG_RAW by default).
+     */
+    struct RunLogValue { static const uint32_t type = RUNLOG_RAW; };
+    template<> struct RunLogValue< int32_t > { static const uint32_t type = RUNLOG_INT32; };
+    template<> struct RunLogValue< uint32_t > { static const uint32_t type = RUNLOG_UINT32; };
+    template<> struct RunLogValue< int64_t > { static const uint32_t type = RUNLOG_INT64; };
+    template<> struct RunLogValue< uint64_t > { static const uint32_t type = RUNLOG_UINT64; };
+    template<> struct RunLogValue< float > { static const uint32_t type = RUNLOG_FLOAT; };
+    template<> struct RunLogValue< double > { static const uint32_t type = RUNLOG_DOUBLE; };
+
+    /**
+     * @brief The RunLogHeader struct Header written once at the beginning of a run log.
+     * Each generation is then a record : generation index and number of chromosomes (2 uint32_t), followed by the columns
+     * genes (nbChromosomes*nbGenes values), fitness (nbChromosomes*nbObjectives values) and, if hasRanks, ranks (int32_t) and crowding distances (double).
+     * Values are written in the byte order of the machine.
+     */
+    struct RunLogHeader
+    {
+        char magic[8];          ///> "SMGALOG" followed by '\0'.
+        uint32_t version;       ///> Version of the format.
+        uint32_t nbGenes;       ///> Number of genes (values of getDatas()) of each chromosome.
+        uint32_t geneType;      ///> RunLogValueType of the genes.
+        uint32_t geneSize;      ///> Size of a gene in bytes.
+        uint32_t nbObjectives;  ///> Number of fitness values of each chromosome.
+        uint32_t fitnessType;   ///> RunLogValueType of the fitness.
+        uint32_t fitnessSize;   ///> Size of a fitness value in bytes.
+        uint32_t hasRanks;      ///> 1 if records have the ranks and crowding distances columns.
+    };
+
+    template<typename DATA, typename F>
+    /**
+     * @brief makeRunLogHeader Create the header of a run log of chromosomes whose genes are DATA and fitness F.
+     * @param nbGenes Number of genes of each chromosome.
+     * @param nbObjectives Number of fitness values of each chromosome.
+     * @param hasRanks true to log the ranks and crowding distances.
+     * @return The header.
+     */
+    RunLogHeader makeRunLogHeader(const unsigned int nbGenes, const unsigned int nbObjectives, const bool hasRanks)
+    {
+        RunLogHeader header;
+        std::memcpy(header.magic, "SMGALOG", 8);
+        header.version = 1;
+        header.nbGenes = nbGenes;
+        header.geneType = RunLogValue< DATA >::type;
+        header.geneSize = sizeof(DATA);
+        header.nbObjectives = nbObjectives;
+        header.fitnessType = RunLogValue< F >::type;
+        header.fitnessSize = sizeof(F);
+        header.hasRanks = hasRanks ? 1 : 0;
+        return header;
+    }
+
+    /**
+     * @brief getRunLogRecordSize Compute the size of the record of a generation.
+     * @param header Header of the run log.
+     * @param nbChromosomes Number of chromosomes of the generation.
+     * @return Size in bytes, record header included.
+     */
+    uint64_t getRunLogRecordSize(const RunLogHeader& header, const uint32_t nbChromosomes);
+
+    /**
+     * @brief The RunLogWriter class Write the generations of a run in a single binary file, with one fixed-width record per generation.
+     * Records are written in a buffer, which is written in the file when it's full, so that a generation costs a few memory copies.
+     * A record is written column by column : beginGeneration, write for all genes, then all fitness (then ranks and distances), endGeneration.
+     */
+    class RunLogWriter
+    {
+    protected:
+        std::ofstream m_file;           ///> File of the run log.
+        RunLogHeader m_header;          ///> Header of the run log.
+        std::vector< char > m_buffer;   ///> Records not written in the file yet.
+        std::size_t m_bufferSize;       ///> Size of m_buffer from which it is written in the file.
+        uint64_t m_recordEnd;           ///> Expected size of m_buffer at the end of the current record.
+        bool m_inRecord;                ///> Indicate that a record has been begun.
+        uint32_t m_nbGenerations;       ///> Number of generations written.
+
+        /**
+         * @brief flushBuffer Write m_buffer in the file and empty it.
+         */
+        virtual void flushBuffer();
+
+    public:
+        /**
+         * @brief RunLogWriter Create the file of a run log and write its header.
+         * @param fileName Name of the file, replaced if it exists.
+         * @param header Header of the run log (see makeRunLogHeader).
+         * @param bufferSize Size of the buffer in bytes.
+         */
+        RunLogWriter(const std::string& fileName, const RunLogHeader& header, const std::size_t bufferSize = 1 << 20);
+        RunLogWriter(const RunLogWriter& other) = delete;
+        virtual ~RunLogWriter();
+
+        RunLogWriter& operator=(const RunLogWriter& other) = delete;
+
+        /**
+         * @brief beginGeneration Begin the record of a generation.
+         * @param generation Index of the generation.
+         * @param nbChromosomes Number of chromosomes of the generation.
+         * @return false if the generation isn't logged (nothing must be written for it), always true for a synchronous writer.
+         */
+        virtual bool beginGeneration(const uint32_t generation, const uint32_t nbChromosomes);
+        /**
+         * @brief write Append values to the record of the current generation, in the order of the columns.
+         * @param datas Values to append.
+         * @param size Size of the values in bytes.
+         */
+        inline void write(const void* datas, const std::size_t size)
+        {
+            const char* bytes = static_cast< const char* >(datas);
+            m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+        }
+        /**
+         * @brief endGeneration End the record of the current generation, checking its size.
+         */
+        void endGeneration();
+
+        /**
+         * @brief flush Write all records in the file.
+         */
+        virtual void flush();
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getHeader Get the header of the run log.
+         * @return The header.
+         */
+        inline const RunLogHeader& getHeader() const { return m_header; }
+        /**
+         * @brief getNbGenerations Get the number of generations written.
+         * @return Number of generations.
+         */
+        inline uint32_t getNbGenerations() const { return m_nbGenerations; }
+    };
+
+    /**
+     * @brief The RunLogGeneration class Columns of a generation read in a run log.
+     */
+    class RunLogGeneration
+    {
+    public:
+        RunLogHeader header;            ///> Header of the run log.
+        uint32_t generation;            ///> Index of the generation.
+        uint32_t nbChromosomes;         ///> Number of chromosomes of the generation.
+        std::vector< char > genes;      ///> Genes of all chromosomes.
+        std::vector< char > fitness;    ///> Fitness of all chromosomes.
+        std::vector< int32_t > ranks;   ///> Rank of each chromosome (empty without ranks).
+        std::vector< double > distances;///> Crowding distance of each chromosome (empty without ranks).
+
+        template<typename T>
+        /**
+         * @brief getGenes Get the genes of a chromosome, T must be the type of the genes.
+         * @param chromosome Index of the chromosome.
+         * @return Pointer on header.nbGenes genes.
+         */
+        inline const T* getGenes(const unsigned int chromosome) const
+        {
+            if (sizeof(T) != header.geneSize)
+                throw std::runtime_error("Type of genes doesn't match the run log!");
+            return reinterpret_cast< const T* >(genes.data()) + chromosome * header.nbGenes;
+        }
+
+        /**
+         * @brief getFitness Get a fitness value converted in double.
+         * @param chromosome Index of the chromosome.
+         * @param objective Index of the objective.
+         * @return Fitness value.
+         */
+        double getFitness(const unsigned int chromosome, const unsigned int objective) const;
+    };
+
+    /**
+     * @brief readRunLogValue Convert a value of a run log in double.
+     * @param value Pointer on the value.
+     * @param type RunLogValueType of the value.
+     * @return Value converted, 0 for RUNLOG_RAW.
+     */
+    double readRunLogValue(const char* value, const uint32_t type);
+
+    /**
+     * @brief The RunLogReader class Read the generations of a run log, in order or by skipping records.
+     */
+    class RunLogReader
+    {
+    protected:
+        std::ifstream m_file;       ///> File of the run log.
+        RunLogHeader m_header;      ///> Header of the run log.
+
+    public:
+        /**
+         * @brief RunLogReader Open a run log and read its header.
+         * @param fileName Name of the file.
+         */
+        RunLogReader(const std::string& fileName);
+        RunLogReader(const RunLogReader& other) = delete;
+        virtual ~RunLogReader();
+
+        RunLogReader& operator=(const RunLogReader& other) = delete;
+
+        /**
+         * @brief readGeneration Read the next generation.
+         * @param generation Columns of the generation, their storage is reused.
+         * @return false at the end of the file.
+         */
+        bool readGeneration(RunLogGeneration& generation);
+        /**
+         * @brief skipGenerations Go after the next records without reading their columns.
+         * @param nbGenerations Number of records to skip.
+         * @return false if the end of the file has been reached.
+         */
+        bool skipGenerations(const unsigned int nbGenerations);
+        /**
+         * @brief seekGeneration Go before the record of a generation, only reading the record headers before it.
+         * @param generation Index of the generation.
+         * @return false if the generation isn't in the run log.
+         */
+        bool seekGeneration(const uint32_t generation);
+        /**
+         * @brief rewind Go back to the first generation.
+         */
+        void rewind();
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getHeader Get the header of the run log.
+         * @return The header.
+         */
+        inline const RunLogHeader& getHeader() const { return m_header; }
+    };
+
+}
+
+#endif // RUNLOG_H
@@ -24,6 +24,13 @@ namespace smoga
          */
         virtual void displayAdvancement();
 
+        /**
+         * @brief writeCheckpoint Write the state of the algorithm, with the elitism parameter.
+         * @param checkpoint Checkpoint receiving the state.
+         */
+        virtual void writeCheckpoint(CheckpointWriter& checkpoint) const;
+        virtual void readCheckpoint(CheckpointReader& checkpoint);
+
     public:
         SingleObjectiveGA(bool consoleDisplay = true);
 
@@ -72,39 +79,28 @@ namespace smoga
     template<typename F, typename P, typename C>
     void SingleObjectiveGA<F, P, C>::runOneGeneration()
     {
-        P* newPop = new P;
-        while (!newPop->isFull())
-        {
-            if (m_elitism)
-                newPop->addKeptChromosomes(this->m_population->getKeptChromosomes());
+        P* newPop = this->prepareNextPopulation();
 
-            // CrossOver only if prob <= prob crossover
-            std::uniform_real_distribution<float> distribution(0.0, 1.0);
-            float probaCrossOver = distribution(generator);
+        // Best chromosomes are kept unchanged
+        if (m_elitism)
+            newPop->addKeptChromosomes(this->m_population->getKeptChromosomes());
 
-            C chromosome;
-            if (probaCrossOver <= P::getCrossOverProbability()) // Crossover
-            {
-                chromosome = this->m_population->crossOver(this->m_population->selectChromosomesPair());
-                newPop->addChromosome(chromosome);
-            }
-            else    // Don't Crossover
-            {
-                chromosome = this->m_population->selectOneChromosome();
-                newPop->addChromosome(chromosome);
-            }
-        }
+        // Other places are filled by offspring, selected, crossed over, mutated and evaluated at once
+        newPop->breed(*this->m_population, this->nextRandomStage());
+        newPop->prepareSelection();
 
-        newPop->mutate();
-        newPop->evaluateFitness();
-        delete this->m_population;
-        this->m_population = newPop;
+        // Previous population becomes the buffer of the next generation
+        std::swap(this->m_population, this->m_nextPopulation);
+
+        if (!this->m_runLogFileName.empty())
+            this->logGeneration();
 
         // Only for Display
         if (m_consoleDisplay)
             displayAdvancement();
 
         this->m_currentGeneration++;
+        this->checkpointGeneration();
     }
 
     template<typename F, typename P, typename C>
@@ -115,8 +111,9 @@ namespace smoga
 
         // Generate a random population make step that need to be done before running algorithm
         this->releaseMemory();
-        this->m_population = new P;
-        this->m_population->generateRandomChromosomes();
+        this->m_population = this->createPopulation();
+        this->m_randomStage = 0;
+        this->m_population->generateRandomChromosomes(this->nextRandomStage());
         this->m_population->evaluateFitness();
         this->m_currentGeneration = 1;
         this->m_isInitialized = true;
@@ -159,6 +156,20 @@ namespace smoga
         std::cout << "]" << "\t" << advancement*100 << "%";
     }
 
+    template<typename F, typename P, typename C>
+    void SingleObjectiveGA<F, P, C>::writeCheckpoint(CheckpointWriter& checkpoint) const
+    {
+        GA<F, P, C>::writeCheckpoint(checkpoint);
+        checkpoint.writeValue< uint8_t >(m_elitism);
+    }
+
+    template<typename F, typename P, typename C>
+    void SingleObjectiveGA<F, P, C>::readCheckpoint(CheckpointReader& checkpoint)
+    {
+        GA<F, P, C>::readCheckpoint(checkpoint);
+        m_elitism = checkpoint.readValue< uint8_t >() != 0;
+    }
+
     template<typename F, typename P, typename C>
     void SingleObjectiveGA<F, P, C>::dumpToFile(const char* fileName)
     {
@@ -167,11 +178,11 @@ namespace smoga
         if (file)
         {
             std::vector< C > chromosomes = this->m_population->getBestSolution();
-            const unsigned int nbSolutions = this->m_population->getBestSolution().size();
+            const unsigned int nbSolutions = chromosomes.size();
             for (unsigned int i = 0 ; i < nbSolutions ; i++)
             {
                 file << "N° " << i << " |\tDatas : " << chromosomes[i].datasToStr() << " | Fitness : ";
-                if (!this->m_population->getBestSolution()[0].getFitness().empty())
+                if (!chromosomes[0].getFitness().empty())
                     file << chromosomes[i].getFitness()[0];
             }
         }
@@ -0,0 +1,377 @@
+#ifndef SOAPOPULATION_H
+#define SOAPOPULATION_H
+
+#include <vector>
+#include <limits>
+#include <random>
+#include <algorithm>
+#include <functional>
+
+#include "random.h"
+#include "threadpool.h"
+#include "nondominatedsorting.h"
+
+namespace smoga
+{
+
+    template<typename F, typename DATA>
+    /**
+     * @brief The SoAPopulation class Provide a structure of arrays storage of a population : a contiguous matrix of genes,
+     * a contiguous matrix of fitness and arrays of ranks and crowding distances, chromosome i being the row i of each of them.
+     * Selection and sorting only work on indexes of rows, so that nothing is moved until gather is called.
+     * All objectives are minimized, like with NSGAII.
+     */
+    class SoAPopulation
+    {
+    protected:
+        unsigned int m_nbChromosomes;       ///> Number of chromosomes (rows).
+        unsigned int m_nbGenes;             ///> Number of genes of each chromosome.
+        unsigned int m_nbObjectives;        ///> Number of objectives of each chromosome.
+
+        std::vector< DATA > m_genes;        ///> Genes of all chromosomes (chromosome i in [i*m_nbGenes, (i+1)*m_nbGenes[).
+        std::vector< F > m_fitness;         ///> Fitness of all chromosomes (chromosome i in [i*m_nbObjectives, (i+1)*m_nbObjectives[).
+        std::vector< int > m_ranks;         ///> Rank (front) of each chromosome.
+        std::vector< double > m_distances;  ///> Crowding distance of each chromosome.
+
+    public:
+        SoAPopulation(const unsigned int nbChromosomes = 0, const unsigned int nbGenes = 0, const unsigned int nbObjectives = 0);
+
+        /**
+         * @brief resize Change the dimensions of the population, rows kept are unchanged.
+         * @param nbChromosomes Number of chromosomes.
+         * @param nbGenes Number of genes of each chromosome.
+         * @param nbObjectives Number of objectives of each chromosome.
+         */
+        void resize(const unsigned int nbChromosomes, const unsigned int nbGenes, const unsigned int nbObjectives);
+
+        /**
+         * @brief load Copy genes and fitness of all chromosomes of a population (array of structures), ranks and distances are reset.
+         * @param population Population to copy.
+         */
+        template<typename P>
+        void load(const P& population);
+
+        /**
+         * @brief evaluate Compute the fitness of all chromosomes with a kernel working on blocks of rows.
+         * @param kernel Function called with (genes of the first row, fitness of the first row, number of rows) for each block.
+         * @param threadPool Pool running blocks in parallel, nullptr to run the kernel once on all rows.
+         */
+        void evaluate(const std::function<void(const DATA*, F*, unsigned int)>& kernel, ThreadPool* threadPool = nullptr);
+
+        /**
+         * @brief sortFronts Determine the non-dominated fronts of the population and set ranks.
+         * @param sorter Engine used to determine fronts.
+         * @return Vector of non-dominated fronts of row indexes, first element correspond to front 1 and so on.
+         */
+        template<typename P, typename C>
+        std::vector< Front > sortFronts(NonDominatedSorter<F, P, C>& sorter);
+
+        /**
+         * @brief crowdingDistanceAssignement Compute the crowding distance of chromosomes of a front, on the fitness matrix.
+         * @param front Row indexes of chromosomes composing the front.
+         */
+        void crowdingDistanceAssignement(const Front& front);
+
+        /**
+         * @brief selectSurvivors Determine the chromosomes kept by the environmental selection of NSGA-II (fronts then crowding distance).
+         * Ranks and crowding distances are set.
+         * @param nbSurvivors Number of chromosomes to keep.
+         * @param sorter Engine used to determine fronts.
+         * @return Row indexes of survivors.
+         */
+        template<typename P, typename C>
+        std::vector< unsigned int > selectSurvivors(const unsigned int nbSurvivors, NonDominatedSorter<F, P, C>& sorter);
+
+        /**
+         * @brief isBetter Compare two chromosomes with the crowded comparison operator (lower rank, then larger distance).
+         * @param index1 Row of the first chromosome.
+         * @param index2 Row of the second chromosome.
+         * @return true if index1 is better than index2.
+         */
+        inline bool isBetter(const unsigned int index1, const unsigned int index2) const
+        {
+            return m_ranks[index1] < m_ranks[index2]
+                    || (m_ranks[index1] == m_ranks[index2] && m_distances[index1] > m_distances[index2]);
+        }
+
+        /**
+         * @brief selectOneIndex Select a chromosome by a crowded tournament between chromosomes drawn with replacement.
+         * @param tournamentSize Number of chromosomes taking part in the tournament.
+         * @return Row of the selected chromosome.
+         */
+        unsigned int selectOneIndex(const unsigned int tournamentSize = 2) const;
+
+        /**
+         * @brief sortIndexes Sort row indexes in ascending order of an objective.
+         * @param indexes Row indexes to sort.
+         * @param objective Index of the objective.
+         */
+        void sortIndexes(std::vector< unsigned int >& indexes, const unsigned int objective) const;
+
+        /**
+         * @brief gather Replace the population by the rows in parameter, in their order.
+         * @param indexes Rows to keep, a row can appear several times.
+         */
+        void gather(const std::vector< unsigned int >& indexes);
+
+        ////////////// Accessors/Setters //////////////
+        inline unsigned int getNbChromosomes() const { return m_nbChromosomes; }
+        inline unsigned int getNbGenes() const { return m_nbGenes; }
+        inline unsigned int getNbObjectives() const { return m_nbObjectives; }
+
+        /**
+         * @brief getGenes Get the genes of a chromosome.
+         * @param index Row of the chromosome.
+         * @return Pointer on its first gene.
+         */
+        inline DATA* getGenes(const unsigned int index) { return &m_genes[index*m_nbGenes]; }
+        inline const DATA* getGenes(const unsigned int index) const { return &m_genes[index*m_nbGenes]; }
+
+        /**
+         * @brief getFitness Get the fitness of a chromosome.
+         * @param index Row of the chromosome.
+         * @return Pointer on its first objective.
+         */
+        inline F* getFitness(const unsigned int index) { return &m_fitness[index*m_nbObjectives]; }
+        inline const F* getFitness(const unsigned int index) const { return &m_fitness[index*m_nbObjectives]; }
+
+        /**
+         * @brief getGeneMatrix Get the genes of all chromosomes.
+         * @return Matrix of genes, row major.
+         */
+        inline const std::vector< DATA >& getGeneMatrix() const { return m_genes; }
+        /**
+         * @brief getFitnessMatrix Get the fitness of all chromosomes.
+         * @return Matrix of fitness, row major.
+         */
+        inline const std::vector< F >& getFitnessMatrix() const { return m_fitness; }
+
+        inline int getRank(const unsigned int index) const { return m_ranks[index]; }
+        inline void setRank(const unsigned int index, const int rank) { m_ranks[index] = rank; }
+
+        inline double getDistance(const unsigned int index) const { return m_distances[index]; }
+        inline void setDistance(const unsigned int index, const double distance) { m_distances[index] = distance; }
+    };
+
+    template<typename F, typename DATA>
+    SoAPopulation<F, DATA>::SoAPopulation(const unsigned int nbChromosomes, const unsigned int nbGenes, const unsigned int nbObjectives)
+        : m_nbChromosomes(0)
+        , m_nbGenes(0)
+        , m_nbObjectives(0)
+        , m_genes()
+        , m_fitness()
+        , m_ranks()
+        , m_distances()
+    {
+        resize(nbChromosomes, nbGenes, nbObjectives);
+    }
+
+    template<typename F, typename DATA>
+    void SoAPopulation<F, DATA>::resize(const unsigned int nbChromosomes, const unsigned int nbGenes, const unsigned int nbObjectives)
+    {
+        if (nbGenes != m_nbGenes || nbObjectives != m_nbObjectives)
+        {
+            m_genes.assign(nbChromosomes*nbGenes, DATA());
+            m_fitness.assign(nbChromosomes*nbObjectives, F());
+        }
+        else
+        {
+            m_genes.resize(nbChromosomes*nbGenes);
+            m_fitness.resize(nbChromosomes*nbObjectives);
+        }
+        m_ranks.resize(nbChromosomes, -1);
+        m_distances.resize(nbChromosomes, 0);
+
+        m_nbChromosomes = nbChromosomes;
+        m_nbGenes = nbGenes;
+        m_nbObjectives = nbObjectives;
+    }
+
+    template<typename F, typename DATA>
+    template<typename P>
+    void SoAPopulation<F, DATA>::load(const P& population)
+    {
+        const unsigned int nbChromosomes = population.getCurrentNbChromosomes();
+        if (nbChromosomes == 0)
+        {
+            resize(0, m_nbGenes, m_nbObjectives);
+            return;
+        }
+
+        resize(nbChromosomes, population.getChromosome(0).getDatas().size(), population.getChromosome(0).getNbObjective());
+        for (unsigned int i = 0 ; i < nbChromosomes ; i++)
+        {
+            const auto& datas = population.getChromosome(i).getDatas();
+            const auto& fitness = population.getChromosome(i).getFitness();
+            std::copy(datas.begin(), datas.begin() + m_nbGenes, getGenes(i));
+            std::copy(fitness.begin(), fitness.begin() + m_nbObjectives, getFitness(i));
+        }
+        std::fill(m_ranks.begin(), m_ranks.end(), -1);
+        std::fill(m_distances.begin(), m_distances.end(), 0);
+    }
+
+    template<typename F, typename DATA>
+    void SoAPopulation<F, DATA>::evaluate(const std::function<void(const DATA*, F*, unsigned int)>& kernel, ThreadPool* threadPool)
+    {
+        if (m_nbChromosomes == 0)
+            return;
+
+        if (!threadPool)
+        {
+            kernel(getGenes(0), getFitness(0), m_nbChromosomes);
+            return;
+        }
+
+        SoAPopulation<F, DATA>* population = this;
+        threadPool->parallelFor(0, m_nbChromosomes, [population, &kernel](const unsigned int begin, const unsigned int end)
+        {
+            kernel(population->getGenes(begin), population->getFitness(begin), end - begin);
+        });
+    }
+
+    template<typename F, typename DATA>
+    template<typename P, typename C>
+    std::vector< Front > SoAPopulation<F, DATA>::sortFronts(NonDominatedSorter<F, P, C>& sorter)
+    {
+        std::vector< Front > fronts = sorter.sortFitnessMatrix(m_fitness.data(), m_nbChromosomes, m_nbObjectives);
+
+        for (unsigned int i = 0 ; i < fronts.size() ; i++)
+        {
+            for (unsigned int p = 0 ; p < fronts[i].size() ; p++)
+                m_ranks[fronts[i][p]] = i;
+        }
+
+        return fronts;
+    }
+
+    template<typename F, typename DATA>
+    void SoAPopulation<F, DATA>::crowdingDistanceAssignement(const Front& front)
+    {
+        const unsigned int nbSolutions = front.size();
+        if (nbSolutions <= 2)
+        {
+            // Alone solution has a null distance, a pair of solutions are both boundary points
+            const double distance = nbSolutions == 1 || m_nbObjectives == 0 ? 0 : std::numeric_limits<double>::max();
+            for (unsigned int i = 0 ; i < nbSolutions ; i++)
+                m_distances[front[i]] = distance;
+            return;
+        }
+
+        for (unsigned int i = 0 ; i < nbSolutions ; i++)
+            m_distances[front[i]] = 0;
+
+        std::vector< unsigned int > sortedFront(front);
+        for (unsigned int m = 0 ; m < m_nbObjectives ; m++)
+        {
+            // Sort using each objective value
+            sortIndexes(sortedFront, m);
+
+            const F minFitness = getFitness(sortedFront[0])[m];
+            F maxMinusMinFitness = getFitness(sortedFront[nbSolutions-1])[m] - minFitness;
+            if (maxMinusMinFitness == 0) // Little cheat to prevent division by 0
+                maxMinusMinFitness = 0.00001;
+
+            // So that boundary point are always selected
+            m_distances[sortedFront[0]] = std::numeric_limits<double>::max();
+            m_distances[sortedFront[nbSolutions-1]] = std::numeric_limits<double>::max();
+
+            // For all other points
+            for (unsigned int i = 1 ; i < nbSolutions-1 ; i++)
+            {
+                double& distance = m_distances[sortedFront[i]];
+                if (distance != std::numeric_limits<double>::max())
+                    distance += (getFitness(sortedFront[i+1])[m] - getFitness(sortedFront[i-1])[m]) / (double)(maxMinusMinFitness);
+            }
+        }
+    }
+
+    template<typename F, typename DATA>
+    template<typename P, typename C>
+    std::vector< unsigned int > SoAPopulation<F, DATA>::selectSurvivors(const unsigned int nbSurvivors, NonDominatedSorter<F, P, C>& sorter)
+    {
+        std::vector< Front > fronts = sortFronts(sorter);
+
+        std::vector< unsigned int > survivors;
+        survivors.reserve(nbSurvivors);
+
+        unsigned int i = 0;         // Index front
+        // Until survivors are filled by whole fronts
+        while (i < fronts.size() && survivors.size() + fronts[i].size() <= nbSurvivors)
+        {
+            crowdingDistanceAssignement(fronts[i]);
+            survivors.insert(survivors.end(), fronts[i].begin(), fronts[i].end());
+            i++;
+        }
+
+        if (survivors.size() < nbSurvivors && i < fronts.size())
+        {
+            // Choose the less crowded chromosomes of the last front
+            crowdingDistanceAssignement(fronts[i]);
+
+            const SoAPopulation<F, DATA>* population = this;
+            std::sort(fronts[i].begin(), fronts[i].end(), [population](const unsigned int index1, const unsigned int index2)
+            {
+                return population->isBetter(index1, index2);
+            });
+            survivors.insert(survivors.end(), fronts[i].begin(), fronts[i].begin() + (nbSurvivors - survivors.size()));
+        }
+
+        return survivors;
+    }
+
+    template<typename F, typename DATA>
+    unsigned int SoAPopulation<F, DATA>::selectOneIndex(const unsigned int tournamentSize) const
+    {
+        std::uniform_int_distribution<unsigned int> distribution(0, m_nbChromosomes-1);
+
+        unsigned int best = distribution(generator);
+        for (unsigned int i = 1 ; i < tournamentSize ; i++)
+        {
+            const unsigned int challenger = distribution(generator);
+            if (isBetter(challenger, best))
+                best = challenger;
+        }
+
+        return best;
+    }
+
+    template<typename F, typename DATA>
+    void SoAPopulation<F, DATA>::sortIndexes(std::vector< unsigned int >& indexes, const unsigned int objective) const
+    {
+        const F* fitness = m_fitness.data();
+        const unsigned int nbObjectives = m_nbObjectives;
+        std::sort(indexes.begin(), indexes.end(), [fitness, nbObjectives, objective](const unsigned int index1, const unsigned int index2)
+        {
+            const F fitness1 = fitness[index1*nbObjectives + objective];
+            const F fitness2 = fitness[index2*nbObjectives + objective];
+            return fitness1 < fitness2 || (fitness1 == fitness2 && index1 < index2);
+        });
+    }
+
+    template<typename F, typename DATA>
+    void SoAPopulation<F, DATA>::gather(const std::vector< unsigned int >& indexes)
+    {
+        const unsigned int nbChromosomes = indexes.size();
+
+        std::vector< DATA > genes(nbChromosomes*m_nbGenes);
+        std::vector< F > fitness(nbChromosomes*m_nbObjectives);
+        std::vector< int > ranks(nbChromosomes);
+        std::vector< double > distances(nbChromosomes);
+        for (unsigned int i = 0 ; i < nbChromosomes ; i++)
+        {
+            std::copy(getGenes(indexes[i]), getGenes(indexes[i]) + m_nbGenes, genes.begin() + i*m_nbGenes);
+            std::copy(getFitness(indexes[i]), getFitness(indexes[i]) + m_nbObjectives, fitness.begin() + i*m_nbObjectives);
+            ranks[i] = m_ranks[indexes[i]];
+            distances[i] = m_distances[indexes[i]];
+        }
+
+        m_genes.swap(genes);
+        m_fitness.swap(fitness);
+        m_ranks.swap(ranks);
+        m_distances.swap(distances);
+        m_nbChromosomes = nbChromosomes;
+    }
+
+}
+
+#endif // SOAPOPULATION_H
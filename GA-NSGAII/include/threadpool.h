@@ -0,0 +1,65 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace smoga
+{
+
+    /**
+     * @brief The ThreadPool class Provide a set of threads created once and reused to run loops in parallel.
+     */
+    class ThreadPool
+    {
+    protected:
+        std::vector< std::thread > m_threads;           ///> Workers of the pool.
+        std::deque< std::function<void()> > m_tasks;    ///> Tasks waiting for a worker.
+        std::mutex m_mutex;                             ///> Protect m_tasks and m_stop.
+        std::condition_variable m_condition;            ///> Wake up workers when a task is added or the pool is stopped.
+        bool m_stop;                                    ///> Indicate that workers must stop.
+
+        /**
+         * @brief workerLoop Run tasks of m_tasks until the pool is stopped.
+         */
+        void workerLoop();
+
+        /**
+         * @brief push Add a task to run by a worker.
+         * @param task Task to run.
+         */
+        void push(const std::function<void()>& task);
+
+    public:
+        /**
+         * @brief ThreadPool Create the workers of the pool.
+         * @param nbThreads Number of threads running loops, including the calling thread (0 for the number of cores).
+         */
+        ThreadPool(unsigned int nbThreads = 0);
+        virtual ~ThreadPool();
+
+        /**
+         * @brief parallelFor Run function on chunks of [begin, end[ with all threads of the pool, the calling thread included.
+         * Returns when all chunks are done, the first exception thrown by function is rethrown.
+         * @param begin First index.
+         * @param end Index after the last one.
+         * @param function Function called with the bounds [chunkBegin, chunkEnd[ of each chunk.
+         * @param grain Minimal number of indexes in a chunk.
+         */
+        void parallelFor(const unsigned int begin, const unsigned int end, const std::function<void(unsigned int, unsigned int)>& function, const unsigned int grain = 1);
+
+        ////////////// Accessors/Setters //////////////
+        /**
+         * @brief getNbThreads Get the number of threads running loops, including the calling thread.
+         * @return Number of threads.
+         */
+        inline unsigned int getNbThreads() const { return m_threads.size() + 1; }
+    };
+
+}
+
+#endif // THREADPOOL_H
@@ -0,0 +1,87 @@
+#include "arena.h"
+
+#include <algorithm>
+
+namespace smoga
+{
+
+    Arena::Arena(const std::size_t blockSize)
+        : m_blocks()
+        , m_currentBlock(0)
+        , m_offset(0)
+        , m_blockSize(blockSize)
+    {
+    }
+
+    Arena::~Arena()
+    {
+        releaseBlocks();
+    }
+
+    void Arena::addBlock(const std::size_t size)
+    {
+        Block block;
+        block.datas = new char[size];
+        block.size = size;
+        m_blocks.push_back(block);
+    }
+
+    void Arena::releaseBlocks()
+    {
+        for (unsigned int i = 0 ; i < m_blocks.size() ; ++i)
+            delete[] m_blocks[i].datas;
+        m_blocks.clear();
+    }
+
+    void* Arena::allocate(const std::size_t size, const std::size_t alignment)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        while (true)
+        {
+            if (m_currentBlock < m_blocks.size())
+            {
+                // Blocks are aligned like std::max_align_t, so aligning the offset is enough
+                const std::size_t alignedOffset = (m_offset + alignment - 1) & ~(alignment - 1);
+                if (alignedOffset + size <= m_blocks[m_currentBlock].size)
+                {
+                    m_offset = alignedOffset + size;
+                    return m_blocks[m_currentBlock].datas + alignedOffset;
+                }
+
+                // Not enough memory left in this block, try the next one
+                ++m_currentBlock;
+                m_offset = 0;
+            }
+            else
+                addBlock(std::max(m_blockSize, size));
+        }
+    }
+
+    void Arena::reset()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // Several blocks have been needed, merge them so that the same allocations fit in one block next time
+        if (m_blocks.size() > 1)
+        {
+            std::size_t capacity = 0;
+            for (unsigned int i = 0 ; i < m_blocks.size() ; ++i)
+                capacity += m_blocks[i].size;
+            releaseBlocks();
+            addBlock(capacity);
+        }
+
+        m_currentBlock = 0;
+        m_offset = 0;
+    }
+
+    std::size_t Arena::getCapacity() const
+    {
+        std::size_t capacity = 0;
+        for (unsigned int i = 0 ; i < m_blocks.size() ; ++i)
+            capacity += m_blocks[i].size;
+        return capacity;
+    }
+
+}
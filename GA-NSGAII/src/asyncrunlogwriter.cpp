@@ -0,0 +1,125 @@
+#include "asyncrunlogwriter.h"
+
+#include <algorithm>
+
+namespace smoga
+{
+
+    AsyncRunLogWriter::AsyncRunLogWriter(const std::string& fileName, const RunLogHeader& header, const unsigned int queueCapacity,
+                                         const Policy policy, const unsigned int samplingInterval)
+        : RunLogWriter(fileName, header, 0)
+        , m_policy(policy)
+        , m_queueCapacity(std::max(1u, queueCapacity))
+        , m_samplingInterval(std::max(1u, samplingInterval))
+        , m_nbDroppedGenerations(0)
+        , m_queue()
+        , m_freeBuffers()
+        , m_isWriting(false)
+        , m_stop(false)
+    {
+        m_writer = std::thread(&AsyncRunLogWriter::writeRecords, this);
+
+        // The header is the first buffer written
+        flushBuffer();
+    }
+
+    AsyncRunLogWriter::~AsyncRunLogWriter()
+    {
+        // Queued records are written before the thread stops
+        flushBuffer();
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_recordQueued.notify_one();
+        m_writer.join();
+    }
+
+    bool AsyncRunLogWriter::beginGeneration(const uint32_t generation, const uint32_t nbChromosomes)
+    {
+        if (m_policy == SAMPLE && generation % m_samplingInterval != 0)
+            return false;
+
+        if (m_policy == DROP)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (m_queue.size() >= m_queueCapacity)
+            {
+                ++m_nbDroppedGenerations;
+                return false;
+            }
+        }
+
+        return RunLogWriter::beginGeneration(generation, nbChromosomes);
+    }
+
+    void AsyncRunLogWriter::flushBuffer()
+    {
+        if (m_buffer.empty())
+            return;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        // Only BLOCK and SAMPLE can wait here, DROP has skipped the generation in beginGeneration
+        m_recordWritten.wait(lock, [this]() { return m_queue.size() < m_queueCapacity; });
+        m_queue.push_back(std::move(m_buffer));
+
+        // Next record is written in a buffer already used, so that its memory is reused
+        if (m_freeBuffers.empty())
+            m_buffer = std::vector< char >();
+        else
+        {
+            m_buffer = std::move(m_freeBuffers.back());
+            m_freeBuffers.pop_back();
+        }
+
+        lock.unlock();
+        m_recordQueued.notify_one();
+    }
+
+    void AsyncRunLogWriter::writeRecords()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (true)
+        {
+            m_recordQueued.wait(lock, [this]() { return !m_queue.empty() || m_stop; });
+            if (m_queue.empty())
+                return;
+
+            std::vector< char > record = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_isWriting = true;
+
+            // The file is only written by this thread, without holding the mutex
+            lock.unlock();
+            m_file.write(record.data(), record.size());
+            record.clear();
+            lock.lock();
+
+            m_isWriting = false;
+            m_freeBuffers.push_back(std::move(record));
+            m_recordWritten.notify_all();
+        }
+    }
+
+    void AsyncRunLogWriter::flush()
+    {
+        if (m_inRecord)
+            throw std::runtime_error("Impossible to flush a run log in the middle of a record!");
+
+        flushBuffer();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_recordWritten.wait(lock, [this]() { return m_queue.empty() && !m_isWriting; });
+        m_file.flush();
+        if (!m_file)
+            throw std::runtime_error("Impossible to write in the run log!");
+    }
+
+    uint64_t AsyncRunLogWriter::getNbDroppedGenerations()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_nbDroppedGenerations;
+    }
+
+}
@@ -0,0 +1,112 @@
+#include "binarydecoder.h"
+
+#include "General.h"
+
+namespace smoga
+{
+
+    BinaryDecoder::BinaryDecoder()
+        : m_variables()
+        , m_nbGenes(0)
+    {
+    }
+
+    void BinaryDecoder::addSegment(Variable& variable, const unsigned int nbBits, const bool firstIsMost, const unsigned int shift)
+    {
+        if (nbBits == 0)
+            return;
+
+        Segment& segment = variable.segments[variable.nbSegments++];
+        segment.firstGene = m_nbGenes;
+        segment.nbBits = nbBits;
+        segment.firstIsMost = firstIsMost;
+        segment.shift = shift;
+        m_nbGenes += nbBits;
+    }
+
+    unsigned int BinaryDecoder::addFixedPointVariable(const unsigned int nbBits, const bool gray)
+    {
+        if (nbBits == 0 || nbBits > 54)
+            throw std::runtime_error("A fixed-point variable must have between 1 and 54 bits!");
+
+        Variable variable;
+        variable.encoding = FIXED_POINT;
+        variable.gray = gray;
+        variable.hasSign = true;
+        variable.signGene = m_nbGenes;
+        variable.nbBits = nbBits - 1;
+        variable.nbSegments = 0;
+        ++m_nbGenes;
+
+        if (nbBits == 1)
+        {
+            // Only a sign : -1 or 1
+            variable.offset = 1;
+            variable.scale = 0;
+        }
+        else
+        {
+            // Same split as getDoubleFromBinary
+            const unsigned int beforeDecimalPoint = 0.6*nbBits;
+            const unsigned int nbFractionBits = nbBits - 1 - beforeDecimalPoint;
+            addSegment(variable, beforeDecimalPoint, true, nbFractionBits);
+            addSegment(variable, nbFractionBits, false, 0);
+            variable.offset = 0;
+            variable.scale = powerOfTwo(-int(nbFractionBits));
+        }
+
+        m_variables.push_back(variable);
+        return m_variables.size() - 1;
+    }
+
+    unsigned int BinaryDecoder::addRangeVariable(const unsigned int nbBits, const double min, const double max, const bool gray)
+    {
+        if (nbBits == 0 || nbBits > 53)
+            throw std::runtime_error("A range variable must have between 1 and 53 bits!");
+
+        Variable variable;
+        variable.encoding = RANGE;
+        variable.gray = gray;
+        variable.hasSign = false;
+        variable.signGene = 0;
+        variable.nbBits = nbBits;
+        variable.nbSegments = 0;
+        addSegment(variable, nbBits, true, 0);
+        variable.offset = min;
+        variable.scale = (max - min) / double((uint64_t(1) << nbBits) - 1);
+
+        m_variables.push_back(variable);
+        return m_variables.size() - 1;
+    }
+
+    void BinaryDecoder::decodePacked(const uint64_t* words, double* values) const
+    {
+        for (unsigned int v = 0 ; v < m_variables.size() ; ++v)
+        {
+            const Variable& variable = m_variables[v];
+
+            uint64_t fixedPoint = 0;
+            for (unsigned int s = 0 ; s < variable.nbSegments ; ++s)
+            {
+                const Segment& segment = variable.segments[s];
+
+                // Genes of the segment, first one in the lowest bit, spread on 2 words at most
+                const unsigned int word = segment.firstGene >> 6;
+                const unsigned int bit = segment.firstGene & 63;
+                uint64_t field = words[word] >> bit;
+                if (bit + segment.nbBits > 64)
+                    field |= words[word + 1] << (64 - bit);
+                if (segment.nbBits < 64)
+                    field &= (uint64_t(1) << segment.nbBits) - 1;
+
+                if (segment.firstIsMost)
+                    field = reverseBits(field, segment.nbBits);
+                fixedPoint |= field << segment.shift;
+            }
+
+            const bool negative = variable.hasSign && ((words[variable.signGene >> 6] >> (variable.signGene & 63)) & 1);
+            values[v] = toValue(variable, fixedPoint, negative);
+        }
+    }
+
+}
@@ -0,0 +1 @@
+#include "bitstringchromosome.h"
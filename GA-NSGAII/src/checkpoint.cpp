@@ -0,0 +1,83 @@
+#include "checkpoint.h"
+
+#include <cstdio>
+
+namespace smoga
+{
+
+    ///////////////////////////////////////////////////////////////
+    /////////////////////// CheckpointWriter //////////////////////
+    ///////////////////////////////////////////////////////////////
+
+    CheckpointWriter::CheckpointWriter(const std::string& fileName, const uint32_t geneSize, const uint32_t fitnessSize)
+        : m_fileName(fileName)
+        , m_temporaryName(fileName + ".tmp")
+        , m_file(m_temporaryName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc)
+    {
+        if (!m_file)
+            throw std::runtime_error("Impossible to open file to write in it!");
+
+        CheckpointHeader header;
+        std::memcpy(header.magic, "SMGACKP", 8);
+        header.version = 1;
+        header.geneSize = geneSize;
+        header.fitnessSize = fitnessSize;
+        writeValue(header);
+    }
+
+    CheckpointWriter::~CheckpointWriter()
+    {
+        // A checkpoint not committed is incomplete, the previous one is kept
+        if (m_file.is_open())
+        {
+            m_file.close();
+            std::remove(m_temporaryName.c_str());
+        }
+    }
+
+    void CheckpointWriter::commit()
+    {
+        m_file.close();
+        if (!m_file)
+            throw std::runtime_error("Impossible to write the checkpoint!");
+
+        // rename replaces the checkpoint at once on POSIX systems, the old one must be removed before on Windows
+        if (std::rename(m_temporaryName.c_str(), m_fileName.c_str()) != 0)
+        {
+            std::remove(m_fileName.c_str());
+            if (std::rename(m_temporaryName.c_str(), m_fileName.c_str()) != 0)
+                throw std::runtime_error("Impossible to replace the checkpoint!");
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    /////////////////////// CheckpointReader //////////////////////
+    ///////////////////////////////////////////////////////////////
+
+    CheckpointReader::CheckpointReader(const std::string& fileName, const uint32_t geneSize, const uint32_t fitnessSize)
+        : m_file(fileName.c_str(), std::ios::in | std::ios::binary)
+        , m_header()
+    {
+        if (!m_file)
+            throw std::runtime_error("Impossible to open file or file doesn't exist!");
+
+        m_file.read(reinterpret_cast< char* >(&m_header), sizeof(m_header));
+        if (!m_file || std::memcmp(m_header.magic, "SMGACKP", 8) != 0)
+            throw std::runtime_error("File is not a checkpoint!");
+        if (m_header.version != 1)
+            throw std::runtime_error("Version of the checkpoint isn't supported!");
+        if (m_header.geneSize != geneSize || m_header.fitnessSize != fitnessSize)
+            throw std::runtime_error("Types of genes and fitness of the checkpoint don't match the algorithm!");
+    }
+
+    CheckpointReader::~CheckpointReader()
+    {
+    }
+
+    void CheckpointReader::read(void* datas, const std::size_t size)
+    {
+        if (!m_file.read(static_cast< char* >(datas), size))
+            throw std::runtime_error("Checkpoint is truncated!");
+    }
+
+}
@@ -0,0 +1 @@
+#include "fitnesscache.h"
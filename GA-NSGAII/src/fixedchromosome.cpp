@@ -0,0 +1 @@
+#include "fixedchromosome.h"
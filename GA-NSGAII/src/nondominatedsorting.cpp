@@ -0,0 +1 @@
+#include "nondominatedsorting.h"
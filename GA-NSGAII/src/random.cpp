@@ -0,0 +1,86 @@
+#include "random.h"
+
+#include <atomic>
+
+thread_local smoga::Philox4x32 generator;
+
+namespace smoga
+{
+
+    namespace
+    {
+        const uint32_t PHILOX_M0 = 0xD2511F53;  // Multipliers of the rounds
+        const uint32_t PHILOX_M1 = 0xCD9E8D57;
+        const uint32_t PHILOX_W0 = 0x9E3779B9;  // Weyl sequence bumping the key between rounds
+        const uint32_t PHILOX_W1 = 0xBB67AE85;
+        const unsigned int PHILOX_NB_ROUNDS = 10;
+
+        std::atomic<uint64_t> runSeed(686452231);   // Seed of the run shared by all threads
+    }
+
+    Philox4x32::Philox4x32(const uint64_t seed, const uint64_t stage, const uint32_t index)
+    {
+        this->seed(seed, stage, index);
+    }
+
+    void Philox4x32::seed(const uint64_t seed, const uint64_t stage, const uint32_t index)
+    {
+        m_key[0] = (uint32_t)seed;
+        m_key[1] = (uint32_t)(seed >> 32);
+        m_counter[0] = 0;
+        m_counter[1] = index;
+        m_counter[2] = (uint32_t)stage;
+        m_counter[3] = (uint32_t)(stage >> 32);
+        m_position = 4;
+    }
+
+    void Philox4x32::generateBlock()
+    {
+        uint32_t key[2] = {m_key[0], m_key[1]};
+        uint32_t block[4] = {m_counter[0], m_counter[1], m_counter[2], m_counter[3]};
+
+        for (unsigned int round = 0 ; round < PHILOX_NB_ROUNDS ; ++round)
+        {
+            const uint64_t product0 = (uint64_t)PHILOX_M0 * block[0];
+            const uint64_t product1 = (uint64_t)PHILOX_M1 * block[2];
+
+            const uint32_t next[4] = {(uint32_t)(product1 >> 32) ^ block[1] ^ key[0],
+                                      (uint32_t)product1,
+                                      (uint32_t)(product0 >> 32) ^ block[3] ^ key[1],
+                                      (uint32_t)product0};
+            block[0] = next[0];
+            block[1] = next[1];
+            block[2] = next[2];
+            block[3] = next[3];
+
+            key[0] += PHILOX_W0;
+            key[1] += PHILOX_W1;
+        }
+
+        m_block[0] = block[0];
+        m_block[1] = block[1];
+        m_block[2] = block[2];
+        m_block[3] = block[3];
+        m_position = 0;
+
+        // A stream provides 2^32 blocks before wrapping
+        ++m_counter[0];
+    }
+
+    void setRandomSeed(const uint64_t seed)
+    {
+        runSeed = seed;
+        generator.seed(seed, UINT64_MAX, 0);
+    }
+
+    uint64_t getRandomSeed()
+    {
+        return runSeed;
+    }
+
+    void selectRandomStream(const uint64_t stage, const uint32_t index)
+    {
+        generator.seed(runSeed, stage, index);
+    }
+
+}
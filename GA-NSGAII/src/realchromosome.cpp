@@ -0,0 +1 @@
+#include "realchromosome.h"
@@ -0,0 +1,205 @@
+#include "runhistory.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace smoga
+{
+
+    RunHistory::RunHistory(const std::string& fileName)
+        : m_fileName(fileName)
+        , m_datas(nullptr)
+        , m_size(0)
+        , m_header()
+        , m_recordOffsets()
+        , m_recordOfGeneration()
+        , m_indexedEnd(sizeof(RunLogHeader))
+    {
+        map();
+        readHeader();
+        indexRecords();
+    }
+
+    RunHistory::~RunHistory()
+    {
+        unmap();
+    }
+
+#ifdef _WIN32
+    void RunHistory::map()
+    {
+        unmap();
+
+        HANDLE file = CreateFileA(m_fileName.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+            throw std::runtime_error("Impossible to open file or file doesn't exist!");
+
+        LARGE_INTEGER size;
+        GetFileSizeEx(file, &size);
+        m_size = size.QuadPart;
+        if (m_size > 0)
+        {
+            // The view stays valid once the handles are closed
+            HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping)
+            {
+                m_datas = static_cast< const char* >(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+
+        if (m_size > 0 && !m_datas)
+            throw std::runtime_error("Impossible to map the run log in memory!");
+    }
+
+    void RunHistory::unmap()
+    {
+        if (m_datas)
+            UnmapViewOfFile(m_datas);
+        m_datas = nullptr;
+        m_size = 0;
+    }
+#else
+    void RunHistory::map()
+    {
+        unmap();
+
+        const int file = open(m_fileName.c_str(), O_RDONLY);
+        if (file < 0)
+            throw std::runtime_error("Impossible to open file or file doesn't exist!");
+
+        struct stat status;
+        fstat(file, &status);
+        m_size = status.st_size;
+        if (m_size > 0)
+        {
+            // The mapping stays valid once the file is closed
+            void* datas = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, file, 0);
+            if (datas != MAP_FAILED)
+                m_datas = static_cast< const char* >(datas);
+        }
+        close(file);
+
+        if (m_size > 0 && !m_datas)
+        {
+            m_size = 0;
+            throw std::runtime_error("Impossible to map the run log in memory!");
+        }
+    }
+
+    void RunHistory::unmap()
+    {
+        if (m_datas)
+            munmap(const_cast< char* >(m_datas), m_size);
+        m_datas = nullptr;
+        m_size = 0;
+    }
+#endif
+
+    void RunHistory::readHeader()
+    {
+        if (m_size < sizeof(m_header))
+        {
+            unmap();
+            throw std::runtime_error("File is not a run log!");
+        }
+
+        std::memcpy(&m_header, m_datas, sizeof(m_header));
+        if (std::memcmp(m_header.magic, "SMGALOG", 8) != 0 || m_header.version != 1)
+        {
+            unmap();
+            throw std::runtime_error("File is not a run log or its version isn't supported!");
+        }
+    }
+
+    void RunHistory::clearIndex()
+    {
+        m_recordOffsets.clear();
+        m_recordOfGeneration.clear();
+        m_indexedEnd = sizeof(m_header);
+    }
+
+    void RunHistory::indexRecords()
+    {
+        uint64_t offset = m_indexedEnd;
+
+        // Only the record headers are read, an incomplete last record (run log still written) is indexed by the next refresh
+        uint32_t indexes[2];
+        while (offset + sizeof(indexes) <= m_size)
+        {
+            std::memcpy(indexes, m_datas + offset, sizeof(indexes));
+            const uint64_t recordSize = getRunLogRecordSize(m_header, indexes[1]);
+            if (offset + recordSize > m_size)
+                break;
+
+            if (indexes[0] >= m_recordOfGeneration.size())
+                m_recordOfGeneration.resize(indexes[0] + 1, -1);
+            m_recordOfGeneration[indexes[0]] = m_recordOffsets.size();
+            m_recordOffsets.push_back(offset);
+            offset += recordSize;
+        }
+        m_indexedEnd = offset;
+    }
+
+    bool RunHistory::refresh()
+    {
+        unsigned int nbRecords = m_recordOffsets.size();
+        map();
+
+        // A run log truncated or rewritten since (new run with the same name) doesn't match the index anymore
+        if (m_indexedEnd > m_size
+                || (m_size >= sizeof(m_header) && std::memcmp(&m_header, m_datas, sizeof(m_header)) != 0))
+        {
+            clearIndex();
+            nbRecords = 0;
+            readHeader();
+        }
+
+        indexRecords();
+        return m_recordOffsets.size() > nbRecords;
+    }
+
+    RunHistoryGeneration RunHistory::getRecord(const unsigned int record) const
+    {
+        const char* datas = m_datas + m_recordOffsets[record];
+
+        uint32_t indexes[2];
+        std::memcpy(indexes, datas, sizeof(indexes));
+
+        RunHistoryGeneration generation;
+        generation.header = &m_header;
+        generation.generation = indexes[0];
+        generation.nbChromosomes = indexes[1];
+        generation.genes = datas + sizeof(indexes);
+        generation.fitness = generation.genes + std::size_t(indexes[1]) * m_header.nbGenes * m_header.geneSize;
+        if (m_header.hasRanks)
+        {
+            generation.ranks = generation.fitness + std::size_t(indexes[1]) * m_header.nbObjectives * m_header.fitnessSize;
+            generation.distances = generation.ranks + std::size_t(indexes[1]) * sizeof(int32_t);
+        }
+        else
+        {
+            generation.ranks = nullptr;
+            generation.distances = nullptr;
+        }
+        return generation;
+    }
+
+    bool RunHistory::getGeneration(const uint32_t generation, RunHistoryGeneration& datas) const
+    {
+        const int record = getRecordIndex(generation);
+        if (record < 0)
+            return false;
+
+        datas = getRecord(record);
+        return true;
+    }
+
+}
@@ -0,0 +1,191 @@
+#include "runlog.h"
+
+namespace smoga
+{
+
+    uint64_t getRunLogRecordSize(const RunLogHeader& header, const uint32_t nbChromosomes)
+    {
+        uint64_t chromosomeSize = uint64_t(header.nbGenes) * header.geneSize + uint64_t(header.nbObjectives) * header.fitnessSize;
+        if (header.hasRanks)
+            chromosomeSize += sizeof(int32_t) + sizeof(double);
+        return 2*sizeof(uint32_t) + nbChromosomes * chromosomeSize;
+    }
+
+    double readRunLogValue(const char* value, const uint32_t type)
+    {
+        // Values may be unaligned in a record, so they are copied before being read
+        switch (type)
+        {
+        case RUNLOG_INT32:  { int32_t v;  std::memcpy(&v, value, sizeof(v)); return v; }
+        case RUNLOG_UINT32: { uint32_t v; std::memcpy(&v, value, sizeof(v)); return v; }
+        case RUNLOG_INT64:  { int64_t v;  std::memcpy(&v, value, sizeof(v)); return v; }
+        case RUNLOG_UINT64: { uint64_t v; std::memcpy(&v, value, sizeof(v)); return v; }
+        case RUNLOG_FLOAT:  { float v;    std::memcpy(&v, value, sizeof(v)); return v; }
+        case RUNLOG_DOUBLE: { double v;   std::memcpy(&v, value, sizeof(v)); return v; }
+        default:
+            return 0;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ///////////////////////// RunLogWriter ////////////////////////
+    ///////////////////////////////////////////////////////////////
+
+    RunLogWriter::RunLogWriter(const std::string& fileName, const RunLogHeader& header, const std::size_t bufferSize)
+        : m_file(fileName.c_str(), std::ios::out | std::ios::binary | std::ios::trunc)
+        , m_header(header)
+        , m_buffer()
+        , m_bufferSize(bufferSize)
+        , m_recordEnd(0)
+        , m_inRecord(false)
+        , m_nbGenerations(0)
+    {
+        if (!m_file)
+            throw std::runtime_error("Impossible to open file to write in it!");
+
+        m_buffer.reserve(bufferSize);
+        write(&m_header, sizeof(m_header));
+    }
+
+    RunLogWriter::~RunLogWriter()
+    {
+        // Records are kept even if the last one is incomplete, the reader stops before it
+        flushBuffer();
+    }
+
+    void RunLogWriter::flushBuffer()
+    {
+        if (m_buffer.empty())
+            return;
+
+        m_file.write(m_buffer.data(), m_buffer.size());
+        m_buffer.clear();
+    }
+
+    bool RunLogWriter::beginGeneration(const uint32_t generation, const uint32_t nbChromosomes)
+    {
+        if (m_inRecord)
+            throw std::runtime_error("The record of the previous generation hasn't been ended!");
+
+        m_recordEnd = m_buffer.size() + getRunLogRecordSize(m_header, nbChromosomes);
+        m_inRecord = true;
+        write(&generation, sizeof(generation));
+        write(&nbChromosomes, sizeof(nbChromosomes));
+        return true;
+    }
+
+    void RunLogWriter::endGeneration()
+    {
+        if (!m_inRecord || m_buffer.size() != m_recordEnd)
+            throw std::runtime_error("The record of the generation doesn't have the size of its columns!");
+
+        m_inRecord = false;
+        ++m_nbGenerations;
+        if (m_buffer.size() >= m_bufferSize)
+            flushBuffer();
+    }
+
+    void RunLogWriter::flush()
+    {
+        if (m_inRecord)
+            throw std::runtime_error("Impossible to flush a run log in the middle of a record!");
+
+        flushBuffer();
+        m_file.flush();
+        if (!m_file)
+            throw std::runtime_error("Impossible to write in the run log!");
+    }
+
+    ///////////////////////////////////////////////////////////////
+    /////////////////////// RunLogGeneration //////////////////////
+    ///////////////////////////////////////////////////////////////
+
+    double RunLogGeneration::getFitness(const unsigned int chromosome, const unsigned int objective) const
+    {
+        const std::size_t index = std::size_t(chromosome) * header.nbObjectives + objective;
+        return readRunLogValue(fitness.data() + index * header.fitnessSize, header.fitnessType);
+    }
+
+    ///////////////////////////////////////////////////////////////
+    ///////////////////////// RunLogReader ////////////////////////
+    ///////////////////////////////////////////////////////////////
+
+    RunLogReader::RunLogReader(const std::string& fileName)
+        : m_file(fileName.c_str(), std::ios::in | std::ios::binary)
+        , m_header()
+    {
+        if (!m_file)
+            throw std::runtime_error("Impossible to open file or file doesn't exist!");
+
+        m_file.read(reinterpret_cast< char* >(&m_header), sizeof(m_header));
+        if (!m_file || std::memcmp(m_header.magic, "SMGALOG", 8) != 0)
+            throw std::runtime_error("File is not a run log!");
+        if (m_header.version != 1)
+            throw std::runtime_error("Version of the run log isn't supported!");
+    }
+
+    RunLogReader::~RunLogReader()
+    {
+    }
+
+    bool RunLogReader::readGeneration(RunLogGeneration& generation)
+    {
+        uint32_t indexes[2];
+        if (!m_file.read(reinterpret_cast< char* >(indexes), sizeof(indexes)))
+            return false;
+
+        const uint32_t nbChromosomes = indexes[1];
+        generation.header = m_header;
+        generation.generation = indexes[0];
+        generation.nbChromosomes = nbChromosomes;
+        generation.genes.resize(std::size_t(nbChromosomes) * m_header.nbGenes * m_header.geneSize);
+        generation.fitness.resize(std::size_t(nbChromosomes) * m_header.nbObjectives * m_header.fitnessSize);
+        generation.ranks.resize(m_header.hasRanks ? nbChromosomes : 0);
+        generation.distances.resize(m_header.hasRanks ? nbChromosomes : 0);
+
+        m_file.read(generation.genes.data(), generation.genes.size());
+        m_file.read(generation.fitness.data(), generation.fitness.size());
+        m_file.read(reinterpret_cast< char* >(generation.ranks.data()), generation.ranks.size() * sizeof(int32_t));
+        m_file.read(reinterpret_cast< char* >(generation.distances.data()), generation.distances.size() * sizeof(double));
+
+        // An incomplete last record (interrupted run) is ignored
+        return bool(m_file);
+    }
+
+    bool RunLogReader::skipGenerations(const unsigned int nbGenerations)
+    {
+        for (unsigned int g = 0 ; g < nbGenerations ; ++g)
+        {
+            uint32_t indexes[2];
+            if (!m_file.read(reinterpret_cast< char* >(indexes), sizeof(indexes)))
+                return false;
+            m_file.seekg(getRunLogRecordSize(m_header, indexes[1]) - sizeof(indexes), std::ios::cur);
+        }
+        return m_file.peek() != std::char_traits< char >::eof();
+    }
+
+    bool RunLogReader::seekGeneration(const uint32_t generation)
+    {
+        rewind();
+        while (true)
+        {
+            uint32_t indexes[2];
+            if (!m_file.read(reinterpret_cast< char* >(indexes), sizeof(indexes)))
+                return false;
+
+            if (indexes[0] == generation)
+            {
+                m_file.seekg(-std::streamoff(sizeof(indexes)), std::ios::cur);
+                return true;
+            }
+            m_file.seekg(getRunLogRecordSize(m_header, indexes[1]) - sizeof(indexes), std::ios::cur);
+        }
+    }
+
+    void RunLogReader::rewind()
+    {
+        m_file.clear();
+        m_file.seekg(sizeof(m_header), std::ios::beg);
+    }
+
+}
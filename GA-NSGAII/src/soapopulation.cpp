@@ -0,0 +1 @@
+#include "soapopulation.h"
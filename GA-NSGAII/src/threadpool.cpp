@@ -0,0 +1,135 @@
+#include "threadpool.h"
+
+#include <atomic>
+#include <memory>
+#include <exception>
+#include <algorithm>
+
+namespace smoga
+{
+
+    ThreadPool::ThreadPool(unsigned int nbThreads)
+        : m_threads()
+        , m_tasks()
+        , m_stop(false)
+    {
+        if (nbThreads == 0)
+            nbThreads = std::max(1u, std::thread::hardware_concurrency());
+
+        // The calling thread also works, so one thread less is needed
+        for (unsigned int i = 1 ; i < nbThreads ; ++i)
+            m_threads.push_back(std::thread(&ThreadPool::workerLoop, this));
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+
+        for (unsigned int i = 0 ; i < m_threads.size() ; ++i)
+            m_threads[i].join();
+    }
+
+    void ThreadPool::workerLoop()
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+                if (m_stop && m_tasks.empty())
+                    return;
+
+                task = m_tasks.front();
+                m_tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    void ThreadPool::push(const std::function<void()>& task)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_tasks.push_back(task);
+        }
+        m_condition.notify_one();
+    }
+
+    /**
+     * @brief The ParallelForState struct State of a parallelFor shared by all threads working on it.
+     */
+    struct ParallelForState
+    {
+        std::atomic<unsigned int> nextChunk;    ///> Index of the next chunk to run.
+        unsigned int nbChunks;                  ///> Number of chunks.
+        unsigned int nbChunksDone;              ///> Number of chunks done.
+        std::exception_ptr exception;           ///> First exception thrown by a chunk.
+        std::mutex mutex;                       ///> Protect nbChunksDone and exception.
+        std::condition_variable done;           ///> Notified when all chunks are done.
+    };
+
+    void ThreadPool::parallelFor(const unsigned int begin, const unsigned int end, const std::function<void(unsigned int, unsigned int)>& function, const unsigned int grain)
+    {
+        if (begin >= end)
+            return;
+
+        const unsigned int nbIndexes = end - begin;
+        // Several chunks per thread to balance unequal chunks
+        const unsigned int chunkSize = std::max(std::max(grain, 1u), nbIndexes / (getNbThreads() * 8));
+        const unsigned int nbChunks = (nbIndexes + chunkSize - 1) / chunkSize;
+
+        if (m_threads.empty() || nbChunks == 1)
+        {
+            function(begin, end);
+            return;
+        }
+
+        // Shared with workers that may start after the end of the loop
+        std::shared_ptr<ParallelForState> state = std::make_shared<ParallelForState>();
+        state->nextChunk = 0;
+        state->nbChunks = nbChunks;
+        state->nbChunksDone = 0;
+
+        std::function<void()> runChunks = [state, begin, end, chunkSize, function]()
+        {
+            unsigned int chunk;
+            while ((chunk = state->nextChunk++) < state->nbChunks)
+            {
+                const unsigned int chunkBegin = begin + chunk*chunkSize;
+                const unsigned int chunkEnd = std::min(end, chunkBegin + chunkSize);
+                std::exception_ptr exception;
+                try {
+                    function(chunkBegin, chunkEnd);
+                }
+                catch (...)
+                {
+                    exception = std::current_exception();
+                }
+
+                std::unique_lock<std::mutex> lock(state->mutex);
+                if (exception && !state->exception)
+                    state->exception = exception;
+                if (++state->nbChunksDone == state->nbChunks)
+                    state->done.notify_all();
+            }
+        };
+
+        const unsigned int nbHelpers = std::min<unsigned int>(m_threads.size(), nbChunks - 1);
+        for (unsigned int i = 0 ; i < nbHelpers ; ++i)
+            push(runChunks);
+
+        // The calling thread works too, so that a loop started from a worker never waits for itself
+        runChunks();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->done.wait(lock, [&state]() { return state->nbChunksDone == state->nbChunks; });
+        if (state->exception)
+            std::rethrow_exception(state->exception);
+    }
+
+}
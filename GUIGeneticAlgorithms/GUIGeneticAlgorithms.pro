@@ -21,6 +21,13 @@ INCLUDEPATH +=  ./include \
 SOURCES +=  ./src/main.cpp \
             ./src/mainwindow.cpp \
             ./src/paramsdockwidget.cpp \
+            ../GA-NSGAII/src/threadpool.cpp \
+            ../GA-NSGAII/src/random.cpp \
+            ../GA-NSGAII/src/arena.cpp \
+            ../GA-NSGAII/src/runlog.cpp \
+            ../GA-NSGAII/src/asyncrunlogwriter.cpp \
+            ../GA-NSGAII/src/runhistory.cpp \
+            ../GA-NSGAII/src/checkpoint.cpp \
             ../GA-NSGAII/example/chromosomeintint.cpp \
             ../GA-NSGAII/example/chromosomemdoubleint.cpp \
             ./src/solutionlisterdockwidget.cpp \
@@ -29,11 +36,19 @@ SOURCES +=  ./src/main.cpp \
 
 HEADERS  += ./include/mainwindow.h \
             ./include/paramsdockwidget.h \
+            ../GA-NSGAII/include/threadpool.h \
+            ../GA-NSGAII/include/random.h \
+            ../GA-NSGAII/include/arena.h \
+            ../GA-NSGAII/include/runlog.h \
+            ../GA-NSGAII/include/asyncrunlogwriter.h \
+            ../GA-NSGAII/include/runhistory.h \
+            ../GA-NSGAII/include/checkpoint.h \
             ../GA-NSGAII/example/chromosomeintint.h \
             ../GA-NSGAII/example/chromosomemdoubleint.h \
             ./include/solutionlisterdockwidget.h \
             ./include/algorithmrunner.h \
-            ./include/paretooptimalfrontwidget.h
+            ./include/paretooptimalfrontwidget.h \
+            ./include/fitnesssnapshot.h
 
 FORMS    += ./gui/mainwindow.ui \
             ./gui/paramsdockwidget.ui \
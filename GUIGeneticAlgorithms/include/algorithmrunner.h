@@ -22,6 +22,7 @@
 #include "chromosomemdoubleint.h"
 
 #include "mainwindow.h"
+#include "fitnesssnapshot.h"
 
 class MainWindow;
 
@@ -45,6 +46,9 @@ private:
     template<typename T, typename P, typename C>
     void configureAndRunAlgorithm(smoga::GA<T, P, C>* algorithm);
 
+    template<typename T, typename P, typename C>
+    FitnessSnapshotPtr takeFitnessSnapshot(const smoga::GA<T, P, C>* algorithm);
+
     template<typename T, typename P, typename C>
     smoga::NSGAII<T, P, C>* createNSGAIIAlgorithm();
 
@@ -67,7 +71,7 @@ signals:
     void fileUnknown();
     void algorithmFailure(const QString& message);
     void updateProgressBar(int progress);
-    void needToUpdateGraph(const QString& fileName);
+    void needToUpdateGraph(FitnessSnapshotPtr snapshot);
 
 public:
     AlgorithmRunner(MainWindow *mainWindow);
@@ -0,0 +1,24 @@
+#ifndef FITNESSSNAPSHOT_H
+#define FITNESSSNAPSHOT_H
+
+#include <vector>
+#include <memory>
+
+/**
+ * @brief The FitnessSnapshot struct Fitness of a population at one generation, filled by the algorithm thread then shared read-only with the GUI.
+ */
+struct FitnessSnapshot
+{
+    int generation;                 ///> Index of the generation, -1 if unknown.
+    unsigned int nbChromosomes;     ///> Number of chromosomes (rows).
+    unsigned int nbObjectives;      ///> Number of objectives (columns).
+    std::vector<double> fitness;    ///> Fitness of the chromosome i for the objective o at i*nbObjectives+o.
+
+    FitnessSnapshot() : generation(-1), nbChromosomes(0), nbObjectives(0), fitness() {}
+
+    inline double getFitness(const unsigned int chromosome, const unsigned int objective) const { return fitness[chromosome*nbObjectives + objective]; }
+};
+
+typedef std::shared_ptr<const FitnessSnapshot> FitnessSnapshotPtr;
+
+#endif // FITNESSSNAPSHOT_H
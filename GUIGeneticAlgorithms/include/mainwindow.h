@@ -62,6 +62,7 @@ public:
     ~MainWindow();
 
     QString getParamsFileName() { return m_paramsFileName; }
+    QString getRunLogFileName();
     Ui::MainWindow* getUI() { return ui; }
     ParamsDockWidget* getParamsDockWidget() { return m_paramsDW; }
 
@@ -80,7 +81,7 @@ public slots:
     void showFileUnknownMessage();
     void showAlgorithmFailureMessage(const QString& message);
     void updateProgressBarValue(int value);
-    void updateParetoOptimalFrontWidget(const QString& fileName);
+    void updateParetoOptimalFrontWidget(FitnessSnapshotPtr snapshot);
     void updateGUIChrono();
 
     void about();
@@ -9,6 +9,8 @@
 
 #include "General.h"
 #include "AlgoString.h"
+#include "runhistory.h"
+#include "fitnesssnapshot.h"
 
 class ParetoOptimalFrontWidget
         : public QWidget
@@ -17,16 +19,24 @@ class ParetoOptimalFrontWidget
 
 private:
     std::string m_currentLoadedGraph;
-    std::vector< std::vector<double> > m_coordinates;
+    std::string m_runLogFileName;
+    smoga::RunHistory* m_runHistory;
+    int m_loadedGeneration;
+    FitnessSnapshotPtr m_snapshot;
 
     int getLoadedGraphId();
     bool fileExist(const std::string& fileName);
+    void loadRecord(const unsigned int record);
 
 public:
     explicit ParetoOptimalFrontWidget(QWidget *parent = 0);
+    virtual ~ParetoOptimalFrontWidget();
 
     void loadFile(const char* fileName);
     void loadFile(const std::string& fileName) { loadFile(fileName.c_str()); }
+    void loadSnapshot(const FitnessSnapshotPtr& snapshot, const std::string& runLogFileName = "");
+    bool loadRunLog(const std::string& fileName, const int generation = -1);
+    void closeRunLog();
 
     void draw(QPaintDevice* device);
 
@@ -81,6 +81,11 @@ bool AlgorithmRunner::performAlgorithm(smoga::GA<T, P, C>* algorithm)
     if (!algorithm->getIfIsInitialized())
         throw std::runtime_error("Algorithm not initialzed !");
 
+    // Generations are only logged in a file on demand, the graph receives the fitness of each generation in memory
+    const QString runLogFileName = m_mainwindow->getRunLogFileName();
+    if (!runLogFileName.isEmpty())
+        algorithm->openRunLog(runLogFileName.toStdString());
+
     while (algorithm->getIndexCurrentGeneration() <= algorithm->getNbGenerationsWanted())
     {
         m_mutex.lock();
@@ -90,31 +95,51 @@ bool AlgorithmRunner::performAlgorithm(smoga::GA<T, P, C>* algorithm)
 
         if (m_breakAlgorithm)
         {
+            algorithm->closeRunLog();
             emit algorithmBroken();
             return false;
         }
 
         emit updateProgressBar(algorithm->getIndexCurrentGeneration() / (double)algorithm->getNbGenerationsWanted()*100);
-        algorithm->runOneGeneration();
-        QString fileName = "generation" + QString::number(algorithm->getIndexCurrentGeneration()-1) + ".txt";
 
         try {
-            algorithm->dumpToFile(fileName.toStdString());
+            algorithm->runOneGeneration();
+
+            // The snapshot is shared with the GUI thread, which only reads it
+            if (dynamic_cast< smoga::NSGAII<T, P, C>* > (algorithm) && !m_breakAlgorithm)
+                emit needToUpdateGraph(takeFitnessSnapshot<T, P, C>(algorithm));
         }
         catch(std::runtime_error& e)
         {
+            algorithm->closeRunLog();
             emit algorithmFailure(e.what());
             emit algorithmBroken();
             return false;
         }
-
-        if (dynamic_cast< smoga::NSGAII<T, P, C>* > (algorithm) && !m_breakAlgorithm)
-            emit needToUpdateGraph(fileName);
     }
 
+    algorithm->closeRunLog();
     return true;
 }
 
+template<typename T, typename P, typename C>
+FitnessSnapshotPtr AlgorithmRunner::takeFitnessSnapshot(const smoga::GA<T, P, C>* algorithm)
+{
+    const std::vector<C>& chromosomes = algorithm->getPopulation().getChromosomes();
+    const unsigned int nbChromosomes = algorithm->getPopulation().getCurrentNbChromosomes();
+
+    std::shared_ptr<FitnessSnapshot> snapshot = std::make_shared<FitnessSnapshot>();
+    snapshot->generation = algorithm->getIndexCurrentGeneration()-1;
+    snapshot->nbChromosomes = nbChromosomes;
+    snapshot->nbObjectives = nbChromosomes == 0 ? 0 : chromosomes[0].getFitness().size();
+    snapshot->fitness.reserve(nbChromosomes * snapshot->nbObjectives);
+    for (unsigned int i = 0 ; i < nbChromosomes ; i++)
+        for (unsigned int o = 0 ; o < snapshot->nbObjectives ; o++)
+            snapshot->fitness.push_back(chromosomes[i].getFitness()[o]);
+
+    return snapshot;
+}
+
 template<typename T, typename P, typename C>
 smoga::NSGAII<T, P, C>* AlgorithmRunner::createNSGAIIAlgorithm()
 {
@@ -47,6 +47,7 @@ MainWindow::MainWindow(QWidget *parent)
 
     // Register Meta Type for signals and solts
     qRegisterMetaType<StringVector>("StringVector");
+    qRegisterMetaType<FitnessSnapshotPtr>("FitnessSnapshotPtr");
 
     statusBar()->showMessage(tr("Ready..."), 3000);
 }
@@ -73,7 +74,7 @@ void MainWindow::openParamsFile()
 
 void MainWindow::openGraphFile()
 {
-    QString filename = QFileDialog::getOpenFileName(this, tr("Open Graph File"), "./", tr("Graph Descriptors (*.txt)"));
+    QString filename = QFileDialog::getOpenFileName(this, tr("Open Graph File"), "./", tr("Graph Descriptors (*.txt);;Run Logs (*.smgalog)"));
     if (!filename.isEmpty())
     {
         m_graphFileName = filename;
@@ -189,6 +190,8 @@ void MainWindow::initThreadAlgorithm()
     repaint();
 
     m_solutionsDW->clearSolutionList();
+    // The run log of the previous run will be replaced
+    m_paretoOptimalFrontW->closeRunLog();
 
     AlgorithmRunner* algorithmRunner = new AlgorithmRunner(this);
     algorithmRunner->moveToThread(&m_mainWindowThread);
@@ -206,23 +209,28 @@ void MainWindow::initThreadAlgorithm()
     // When algorithm encounter problems
     connect(algorithmRunner, SIGNAL(algorithmBroken()), this, SLOT(handleAlgorithmProblem()));
 
-    // To update graph drawing
-    connect(algorithmRunner, SIGNAL(needToUpdateGraph(const QString&)), this, SLOT(updateParetoOptimalFrontWidget(const QString&)));
+    // To update graph drawing, snapshots are queued from the algorithm thread
+    connect(algorithmRunner, SIGNAL(needToUpdateGraph(FitnessSnapshotPtr)), this, SLOT(updateParetoOptimalFrontWidget(FitnessSnapshotPtr)), Qt::QueuedConnection);
     m_mainWindowThread.start();
 }
 
-void MainWindow::updateParetoOptimalFrontWidget(const QString& fileName)
+QString MainWindow::getRunLogFileName()
+{
+    return ui->action_Write_Run_Log->isChecked() ? QString("run.smgalog") : QString();
+}
+
+void MainWindow::updateParetoOptimalFrontWidget(FitnessSnapshotPtr snapshot)
 {
     m_paretoOptimalFrontW->show();
 
     try {
-        m_paretoOptimalFrontW->loadFile(fileName.toStdString());
+        m_paretoOptimalFrontW->loadSnapshot(snapshot, getRunLogFileName().toStdString());
         if (ui->action_Register_Graphs->isChecked())
         {
             QImage* render = new QImage(m_paretoOptimalFrontW->width(), m_paretoOptimalFrontW->height(), QImage::Format_RGB32);
             render->fill(Qt::white);
             m_paretoOptimalFrontW->draw(render);
-            render->save(fileName.split('.')[0] + ".png", 0, 100);
+            render->save("generation" + QString::number(snapshot->generation) + ".png", 0, 100);
             delete render;
 
         }
@@ -248,7 +256,16 @@ void MainWindow::loadGraph()
     m_paretoOptimalFrontW->show();
 
     try {
-        m_paretoOptimalFrontW->loadFile(m_graphFileName.toStdString());
+        // A run log is browsed from its last generation
+        if (m_graphFileName.endsWith(".smgalog"))
+        {
+            if (!m_paretoOptimalFrontW->loadRunLog(m_graphFileName.toStdString()))
+                QMessageBox::warning(this,
+                                     tr("Empty Run Log"),
+                                     tr("No generation written in the run log!"));
+        }
+        else
+            m_paretoOptimalFrontW->loadFile(m_graphFileName.toStdString());
     }
     catch(std::runtime_error& e)
     {
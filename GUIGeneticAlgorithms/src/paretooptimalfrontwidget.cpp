@@ -1,16 +1,27 @@
 #include "paretooptimalfrontwidget.h"
 
 ParetoOptimalFrontWidget::ParetoOptimalFrontWidget(QWidget *parent) :
-    QWidget(parent)
+    QWidget(parent),
+    m_runLogFileName(),
+    m_runHistory(nullptr),
+    m_loadedGeneration(-1),
+    m_snapshot()
 {
     setMinimumSize(200, 225);
 }
 
+ParetoOptimalFrontWidget::~ParetoOptimalFrontWidget()
+{
+    delete m_runHistory;
+}
+
 void ParetoOptimalFrontWidget::loadFile(const char* fileName)
 {
     m_currentLoadedGraph = fileName;
+    closeRunLog();
+    m_runLogFileName.clear();
     setWindowTitle(QString(m_currentLoadedGraph.c_str()));
-    m_coordinates.clear();
+    std::shared_ptr<FitnessSnapshot> snapshot = std::make_shared<FitnessSnapshot>();
 
     std::ifstream file(fileName, std::ios::in);  // Open file
 
@@ -37,16 +48,81 @@ void ParetoOptimalFrontWidget::loadFile(const char* fileName)
             for (unsigned int i = 0 ; i  < fitnessValue.size() ; i++)
                 fitnessValue[i] = trim(fitnessValue[i]);
 
-            std::vector<double> coordinates;
-            for (unsigned int i = 0 ; i  < fitnessValue.size()-1 ; i++)
-                coordinates.push_back(getNumber<double>(fitnessValue[i]));
-            m_coordinates.push_back(coordinates);
+            // All lines have the number of objectives of the first one
+            if (snapshot->nbChromosomes == 0)
+                snapshot->nbObjectives = fitnessValue.size()-1;
+            for (unsigned int i = 0 ; i  < snapshot->nbObjectives ; i++)
+                snapshot->fitness.push_back(i < fitnessValue.size()-1 ? getNumber<double>(fitnessValue[i]) : 0);
+            snapshot->nbChromosomes++;
         }
 
         file.close();  // Close file
     }
     else
         throw std::runtime_error("Impossible to open file or file doesn't exist!");
+    m_snapshot = snapshot;
+    update();
+}
+
+void ParetoOptimalFrontWidget::loadSnapshot(const FitnessSnapshotPtr& snapshot, const std::string& runLogFileName)
+{
+    // The run log is only opened if the graph is browsed
+    if (m_runHistory && m_runHistory->getFileName() != runLogFileName)
+        closeRunLog();
+    m_runLogFileName = runLogFileName;
+
+    m_snapshot = snapshot;
+    m_loadedGeneration = snapshot->generation;
+    m_currentLoadedGraph = "generation" + std::to_string(snapshot->generation);
+    setWindowTitle(QString(m_currentLoadedGraph.c_str()));
+    update();
+}
+
+bool ParetoOptimalFrontWidget::loadRunLog(const std::string& fileName, const int generation)
+{
+    // The history of the same run is kept, only the records written since the last call are indexed
+    if (m_runHistory && m_runHistory->getFileName() != fileName)
+        closeRunLog();
+    if (!m_runHistory)
+        m_runHistory = new smoga::RunHistory(fileName);
+    else if (generation < 0 || m_runHistory->getRecordIndex(generation) < 0)
+        m_runHistory->refresh();
+    m_runLogFileName = fileName;
+
+    // A negative generation loads the last generation written
+    const int record = generation < 0 ? int(m_runHistory->getNbRecords()) - 1 : m_runHistory->getRecordIndex(generation);
+    if (record < 0)
+        return false;
+
+    loadRecord(record);
+    return true;
+}
+
+void ParetoOptimalFrontWidget::closeRunLog()
+{
+    delete m_runHistory;
+    m_runHistory = nullptr;
+}
+
+void ParetoOptimalFrontWidget::loadRecord(const unsigned int record)
+{
+    const smoga::RunHistoryGeneration datas = m_runHistory->getRecord(record);
+
+    m_loadedGeneration = datas.generation;
+    m_currentLoadedGraph = "generation" + std::to_string(datas.generation);
+    setWindowTitle(QString(m_currentLoadedGraph.c_str()));
+
+    // Columns are read in the mapped file, only the fitness are kept
+    std::shared_ptr<FitnessSnapshot> snapshot = std::make_shared<FitnessSnapshot>();
+    snapshot->generation = datas.generation;
+    snapshot->nbChromosomes = datas.nbChromosomes;
+    snapshot->nbObjectives = datas.header->nbObjectives;
+    snapshot->fitness.resize(snapshot->nbChromosomes * snapshot->nbObjectives);
+    for (unsigned int i = 0 ; i < snapshot->nbChromosomes ; i++)
+        for (unsigned int o = 0 ; o < snapshot->nbObjectives ; o++)
+            snapshot->fitness[i*snapshot->nbObjectives + o] = datas.getFitness(i, o);
+    m_snapshot = snapshot;
+
     update();
 }
 
@@ -64,26 +140,25 @@ void ParetoOptimalFrontWidget::draw(QPaintDevice* device)
     int min = std::min(width(), height());
     p.setViewport((width()-min)/2, (height()-min)/2, min, min);
 
-    if (!m_coordinates.empty()
-            && m_coordinates[0].size() < 2)
+    const FitnessSnapshotPtr& snapshot = m_snapshot;
+    if (!snapshot
+            || snapshot->nbChromosomes == 0
+            || snapshot->nbObjectives < 2)
         return;
 
     //////////// Search extremes value on X and Y axis ////////////
-    // Init axis
-    PairMinMax axisX, axisY;
-    axisX.index = 0;
-    axisX.m_minMax = std::pair<double, double>(m_coordinates[0][0], m_coordinates[0][0]);
-    axisY.index = 1;
-    axisY.m_minMax = std::pair<double, double>(m_coordinates[0][1], m_coordinates[0][1]);
-
-    // Search
-    axisX = std::for_each(m_coordinates.begin(), m_coordinates.end(), axisX);
-    axisY = std::for_each(m_coordinates.begin(), m_coordinates.end(), axisY);
+    std::pair<double, double> axisX(snapshot->getFitness(0, 0), snapshot->getFitness(0, 0));
+    std::pair<double, double> axisY(snapshot->getFitness(0, 1), snapshot->getFitness(0, 1));
+    for (unsigned int i = 1 ; i < snapshot->nbChromosomes ; i++)
+    {
+        axisX = std::pair<double, double>(std::min(snapshot->getFitness(i, 0), axisX.first), std::max(snapshot->getFitness(i, 0), axisX.second));
+        axisY = std::pair<double, double>(std::min(snapshot->getFitness(i, 1), axisY.first), std::max(snapshot->getFitness(i, 1), axisY.second));
+    }
 
     // Determine graph width and height, and keep them to 800 for the window
     double width, height, cWidth, cHeight;
-    width = axisX.m_minMax.second - axisX.m_minMax.first;
-    height = axisY.m_minMax.second - axisY.m_minMax.first;
+    width = axisX.second - axisX.first;
+    height = axisY.second - axisY.first;
 
     if(width == 0)
         width = 800;
@@ -159,29 +234,58 @@ void ParetoOptimalFrontWidget::draw(QPaintDevice* device)
     pen.setColor(Qt::red);
     p.setPen(pen);
     p.setBrush(QBrush(Qt::red));
-    for (unsigned int i = 0 ; i < m_coordinates.size() ; i++)
+    for (unsigned int i = 0 ; i < snapshot->nbChromosomes ; i++)
     {
-        p.drawEllipse(QPointF(m_coordinates[i][0]*coefficientW, -m_coordinates[i][1]*coefficientH), 5, 5);
+        p.drawEllipse(QPointF(snapshot->getFitness(i, 0)*coefficientW, -snapshot->getFitness(i, 1)*coefficientH), 5, 5);
     }
 }
 
 void ParetoOptimalFrontWidget::keyPressEvent(QKeyEvent* event)
 {
-    int ID;
+    int step;
     switch (event->key())
     {
     case Qt::Key_Left:
-        ID = getLoadedGraphId();
-        --ID;
+        step = -1;
         break;
     case Qt::Key_Right:
-        ID = getLoadedGraphId();
-        ++ID;
+        step = 1;
         break;
     default:
         return;
     }
 
+    // Graph of a run : load the previous or next record of its run log, generations may not be contiguous (sampled run log)
+    if (!m_runLogFileName.empty())
+    {
+        try {
+            if (!m_runHistory)
+                m_runHistory = new smoga::RunHistory(m_runLogFileName);
+
+            int record = m_runHistory->getRecordIndex(m_loadedGeneration);
+            if (record < 0 || record + step >= int(m_runHistory->getNbRecords()))
+            {
+                m_runHistory->refresh();
+                record = m_runHistory->getRecordIndex(m_loadedGeneration);
+            }
+            // Snapshot of a generation not written yet : go back to the last generation written
+            if (record < 0)
+                record = m_runHistory->getNbRecords();
+
+            record += step;
+            if (record >= 0 && record < int(m_runHistory->getNbRecords()))
+                loadRecord(record);
+        }
+        catch (std::runtime_error&)
+        {
+            // Run log not written yet
+        }
+        QWidget::keyPressEvent(event);
+        return;
+    }
+
+    const int ID = getLoadedGraphId() + step;
+
     std::ostringstream fileName;
     fileName << "generation" << ID << ".txt";
     if (fileExist(fileName.str()))
@@ -194,6 +298,8 @@ int ParetoOptimalFrontWidget::getLoadedGraphId()
 {
     if (m_currentLoadedGraph == "")
         return -1;
+    if (!m_runLogFileName.empty())
+        return m_loadedGeneration;
 
     return extractNumberFromStr<int>(m_currentLoadedGraph);
 }